@@ -0,0 +1,42 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_CPP__CONFLATION_HPP_
+#define RMW_CONNEXT_CPP__CONFLATION_HPP_
+
+#include <cstdint>
+
+#include "rmw/rmw.h"
+#include "rmw/types.h"
+
+#include "rmw_connext_cpp/visibility_control.h"
+
+namespace rmw_connext_cpp
+{
+
+/// Return the number of samples a latest only subscription dropped in favor of newer ones.
+/**
+ * \param subscription created with SubscriptionOptions::latest_only
+ * \param count [out] number of samples dropped since the subscription was created
+ * \return RMW_RET_OK if successful, or
+ * \return RMW_RET_INVALID_ARGUMENT if an argument is null, or
+ * \return RMW_RET_ERROR if the subscription is not from this implementation
+ */
+RMW_CONNEXT_CPP_PUBLIC
+rmw_ret_t
+get_subscription_conflated_count(const rmw_subscription_t * subscription, uint64_t * count);
+
+}  // namespace rmw_connext_cpp
+
+#endif  // RMW_CONNEXT_CPP__CONFLATION_HPP_
@@ -18,6 +18,9 @@
 #include <atomic>
 
 #include "rmw_connext_shared_cpp/ndds_include.hpp"
+#include "rmw_connext_shared_cpp/discovery_timeline.hpp"
+#include "rmw_connext_shared_cpp/sample_size.hpp"
+#include "rmw_connext_shared_cpp/topic_statistics.hpp"
 #include "rmw_connext_shared_cpp/types.hpp"
 #include "rmw_connext_shared_cpp/connext_static_event_info.hpp"
 
@@ -29,6 +32,10 @@
 #include "rmw/types.h"
 #include "rmw/ret_types.h"
 
+#include "rmw_connext_cpp/identifier.hpp"
+#include "rmw_connext_cpp/match_metrics.hpp"
+#include "rmw_connext_cpp/traffic_counters.hpp"
+
 class ConnextPublisherListener;
 
 struct ConnextStaticPublisherInfo : ConnextCustomEventInfo
@@ -37,6 +44,13 @@ struct ConnextStaticPublisherInfo : ConnextCustomEventInfo
   ConnextPublisherListener * listener_;
   DDS::DataWriter * topic_writer_;
   const message_type_support_callbacks_t * callbacks_;
+  /// Largest serialized size of the samples of this type, used to size later sample pools.
+  SampleSizeRecord * sample_size_record_;
+  /// Messages and bytes published.
+  rmw_connext_cpp::TrafficCounter traffic_counter_;
+  /// Whether statistics of the published messages are computed.
+  bool statistics_enabled_;
+  TopicStatistics statistics_;
   rmw_gid_t publisher_gid;
 
   /**
@@ -58,10 +72,21 @@ class ConnextPublisherListener : public DDS::PublisherListener
 {
 public:
   virtual void on_publication_matched(
-    DDSDataWriter *,
+    DDSDataWriter * writer,
     const DDS_PublicationMatchedStatus & status)
   {
     current_count_ = status.current_count;
+    if (status.current_count_change == 0) {
+      return;
+    }
+    bool first_match = match_recorder_.record(
+      status.current_count_change > 0, status.last_subscription_handle, status.current_count);
+    if (first_match) {
+      record_discovery_event(
+        DiscoveryEvent::PublisherFirstMatched,
+        writer->get_instance_handle(),
+        writer->get_topic()->get_name());
+    }
   }
 
   std::size_t current_count() const
@@ -69,8 +94,14 @@ public:
     return current_count_;
   }
 
+  const MatchRecorder & match_recorder() const
+  {
+    return match_recorder_;
+  }
+
 private:
   std::atomic<std::size_t> current_count_;
+  MatchRecorder match_recorder_{rti_connext_identifier};
 };
 
 #endif  // RMW_CONNEXT_CPP__CONNEXT_STATIC_PUBLISHER_INFO_HPP_
@@ -19,6 +19,10 @@
 
 #include "rmw_connext_shared_cpp/ndds_include.hpp"
 #include "rmw_connext_shared_cpp/connext_static_event_info.hpp"
+#include "rmw_connext_shared_cpp/discovery_timeline.hpp"
+#include "rmw_connext_shared_cpp/sample_size.hpp"
+#include "rmw_connext_shared_cpp/sample_status_totals.hpp"
+#include "rmw_connext_shared_cpp/topic_statistics.hpp"
 #include "rmw_connext_shared_cpp/types.hpp"
 
 #include "ndds/ndds_cpp.h"
@@ -28,6 +32,10 @@
 #include "rmw/types.h"
 #include "rmw/ret_types.h"
 
+#include "rmw_connext_cpp/identifier.hpp"
+#include "rmw_connext_cpp/match_metrics.hpp"
+#include "rmw_connext_cpp/traffic_counters.hpp"
+
 class ConnextSubscriberListener;
 
 struct ConnextStaticSubscriberInfo : ConnextCustomEventInfo
@@ -35,8 +43,23 @@ struct ConnextStaticSubscriberInfo : ConnextCustomEventInfo
   DDS::Subscriber * dds_subscriber_;
   ConnextSubscriberListener * listener_;
   DDS::DataReader * topic_reader_;
+  /// Topic the reader was created on if the subscription has a filter expression, or nullptr.
+  DDS::ContentFilteredTopic * content_filtered_topic_;
   DDS::ReadCondition * read_condition_;
   const message_type_support_callbacks_t * callbacks_;
+  /// Largest serialized size of the samples of this type, used to size later sample pools.
+  SampleSizeRecord * sample_size_record_;
+  /// Take every available sample at once and only use the newest one.
+  bool latest_only_;
+  /// Number of older samples dropped by latest only takes.
+  std::atomic<uint64_t> conflated_count_;
+  /// Messages and bytes taken.
+  rmw_connext_cpp::TrafficCounter traffic_counter_;
+  /// Whether statistics of the taken messages are computed.
+  bool statistics_enabled_;
+  TopicStatistics statistics_;
+  /// Sample lost and rejected totals of the traffic counters.
+  SampleStatusTotals sample_status_totals_;
   /// Remap the specific RTI Connext DDS DataReader Status to a generic RMW status type.
   /**
    * \param mask input status mask
@@ -54,10 +77,28 @@ class ConnextSubscriberListener : public DDS::SubscriberListener
 {
 public:
   virtual void on_subscription_matched(
-    DDSDataReader *,
+    DDSDataReader * reader,
     const DDS_SubscriptionMatchedStatus & status)
   {
     current_count_ = status.current_count;
+    if (status.current_count_change == 0) {
+      return;
+    }
+    bool first_match = match_recorder_.record(
+      status.current_count_change > 0, status.last_publication_handle, status.current_count);
+    if (first_match) {
+      // report the name of the underlying topic for content filtered subscriptions
+      DDS::TopicDescription * topic_description = reader->get_topicdescription();
+      DDS::ContentFilteredTopic * filtered_topic =
+        DDS::ContentFilteredTopic::narrow(topic_description);
+      if (filtered_topic) {
+        topic_description = filtered_topic->get_related_topic();
+      }
+      record_discovery_event(
+        DiscoveryEvent::SubscriberFirstMatched,
+        reader->get_instance_handle(),
+        topic_description->get_name());
+    }
   }
 
   std::size_t current_count() const
@@ -65,8 +106,14 @@ public:
     return current_count_;
   }
 
+  const MatchRecorder & match_recorder() const
+  {
+    return match_recorder_;
+  }
+
 private:
   std::atomic<std::size_t> current_count_;
+  MatchRecorder match_recorder_{rti_connext_identifier};
 };
 
 #endif  // RMW_CONNEXT_CPP__CONNEXT_STATIC_SUBSCRIBER_INFO_HPP_
@@ -0,0 +1,62 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_CPP__CONTENT_FILTER_HPP_
+#define RMW_CONNEXT_CPP__CONTENT_FILTER_HPP_
+
+#include <cstddef>
+
+#include "rmw/rmw.h"
+#include "rmw/types.h"
+
+#include "rmw_connext_shared_cpp/ndds_include.hpp"
+
+#include "rmw_connext_cpp/visibility_control.h"
+
+namespace rmw_connext_cpp
+{
+
+/// Copy filter expression parameters into a DDS string sequence.
+/**
+ * \param parameters array of parameters, can be null if count is 0
+ * \param count number of parameters
+ * \param sequence [out] sequence holding a copy of the parameters
+ * \return true if successful, false if a parameter is null or the sequence can't be resized
+ */
+RMW_CONNEXT_CPP_PUBLIC
+bool
+fill_filter_parameters(
+  const char * const * parameters, size_t count, DDS::StringSeq & sequence);
+
+/// Update the expression parameters of a content filtered subscription.
+/**
+ * The new parameters are propagated to the matched data writers, which apply them to the
+ * samples they send from then on.
+ *
+ * \param subscription created with a filter expression in its SubscriptionOptions
+ * \param parameters new values of the parameters, referenced as %0, %1, ... in the expression
+ * \param count number of parameters, has to match the parameters used by the expression
+ * \return RMW_RET_OK if successful, or
+ * \return RMW_RET_INVALID_ARGUMENT if an argument is null, or
+ * \return RMW_RET_ERROR if the subscription is not from this implementation, has no filter or
+ *   the parameters can't be set
+ */
+RMW_CONNEXT_CPP_PUBLIC
+rmw_ret_t
+set_subscription_filter_parameters(
+  const rmw_subscription_t * subscription, const char * const * parameters, size_t count);
+
+}  // namespace rmw_connext_cpp
+
+#endif  // RMW_CONNEXT_CPP__CONTENT_FILTER_HPP_
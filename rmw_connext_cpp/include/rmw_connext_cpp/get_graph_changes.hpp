@@ -0,0 +1,53 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_CPP__GET_GRAPH_CHANGES_HPP_
+#define RMW_CONNEXT_CPP__GET_GRAPH_CHANGES_HPP_
+
+#include <vector>
+
+#include "rmw/rmw.h"
+
+#include "rmw_connext_shared_cpp/graph_changes.hpp"
+
+#include "rmw_connext_cpp/visibility_control.h"
+
+namespace rmw_connext_cpp
+{
+
+/// Return the discovery changes seen by a node since the given cursor.
+/**
+ * This allows graph monitors to do work proportional to the number of changes when the
+ * graph guard condition triggers, instead of rescanning the whole graph.
+ * The cursor is advanced past the returned changes.
+ * When `complete` is false older changes were already discarded and the caller has to
+ * rebuild its view of the graph before consuming further changes.
+ *
+ * \param node to query
+ * \param cursor [in/out] position in the change logs, zero-initialize it for the first call
+ * \param changes [out] changes recorded after the cursor, appended
+ * \param complete [out] false if some changes after the cursor were discarded
+ * \return RMW_RET_OK if successful, otherwise an error code
+ */
+RMW_CONNEXT_CPP_PUBLIC
+rmw_ret_t
+get_graph_changes(
+  const rmw_node_t * node,
+  ConnextGraphChangeCursor * cursor,
+  std::vector<ConnextGraphChange> * changes,
+  bool * complete);
+
+}  // namespace rmw_connext_cpp
+
+#endif  // RMW_CONNEXT_CPP__GET_GRAPH_CHANGES_HPP_
@@ -0,0 +1,54 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_CPP__MATCH_METRICS_HPP_
+#define RMW_CONNEXT_CPP__MATCH_METRICS_HPP_
+
+#include "rmw/rmw.h"
+#include "rmw/types.h"
+
+#include "rmw_connext_shared_cpp/match_recorder.hpp"
+
+#include "rmw_connext_cpp/visibility_control.h"
+
+namespace rmw_connext_cpp
+{
+
+/// Return the time to first match and the match history of a publisher.
+/**
+ * \param publisher to query
+ * \param metrics [out] filled with the match metrics of the publisher
+ * \return RMW_RET_OK if successful, or
+ * \return RMW_RET_INVALID_ARGUMENT if an argument is null, or
+ * \return RMW_RET_ERROR if the publisher is not from this implementation
+ */
+RMW_CONNEXT_CPP_PUBLIC
+rmw_ret_t
+get_publisher_match_metrics(const rmw_publisher_t * publisher, MatchMetrics * metrics);
+
+/// Return the time to first match and the match history of a subscription.
+/**
+ * \param subscription to query
+ * \param metrics [out] filled with the match metrics of the subscription
+ * \return RMW_RET_OK if successful, or
+ * \return RMW_RET_INVALID_ARGUMENT if an argument is null, or
+ * \return RMW_RET_ERROR if the subscription is not from this implementation
+ */
+RMW_CONNEXT_CPP_PUBLIC
+rmw_ret_t
+get_subscription_match_metrics(const rmw_subscription_t * subscription, MatchMetrics * metrics);
+
+}  // namespace rmw_connext_cpp
+
+#endif  // RMW_CONNEXT_CPP__MATCH_METRICS_HPP_
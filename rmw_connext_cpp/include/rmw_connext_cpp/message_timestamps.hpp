@@ -0,0 +1,98 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_CPP__MESSAGE_TIMESTAMPS_HPP_
+#define RMW_CONNEXT_CPP__MESSAGE_TIMESTAMPS_HPP_
+
+#include <cstdint>
+
+#include "rmw/rmw.h"
+#include "rmw/types.h"
+
+#include "rmw_connext_cpp/visibility_control.h"
+
+namespace rmw_connext_cpp
+{
+
+/// Times at which a taken message was written and received, since the epoch.
+struct MessageTimestamps
+{
+  /// Time of the write, taken from the clock of the publishing host.
+  rmw_time_t source_timestamp;
+  /// Time of the reception, taken from the clock of the subscribing host.
+  rmw_time_t reception_timestamp;
+};
+
+/// Get the time spent by a message between its write and its reception, in nanoseconds.
+/**
+ * Across hosts the result includes the offset between their clocks, and can be negative.
+ * Feed it to a LatencyHistogram to get the latency distribution of a topic.
+ */
+inline
+int64_t
+get_latency_ns(const MessageTimestamps & timestamps)
+{
+  auto to_ns = [](const rmw_time_t & time) {
+      return static_cast<int64_t>(time.sec) * 1000000000LL + static_cast<int64_t>(time.nsec);
+    };
+  return to_ns(timestamps.reception_timestamp) - to_ns(timestamps.source_timestamp);
+}
+
+/// Take a message like rmw_take_with_info(), and also get its timestamps.
+/**
+ * \param subscription to take from
+ * \param ros_message [out] the taken message
+ * \param taken [out] whether a message was taken
+ * \param message_info [out] filled if a message was taken
+ * \param timestamps [out] filled if a message was taken
+ * \param allocation unused
+ * \return RMW_RET_OK if successful, or
+ * \return RMW_RET_INVALID_ARGUMENT if message_info or timestamps is null, or
+ * \return RMW_RET_ERROR if an unexpected error occurs
+ */
+RMW_CONNEXT_CPP_PUBLIC
+rmw_ret_t
+take_with_timestamps(
+  const rmw_subscription_t * subscription,
+  void * ros_message,
+  bool * taken,
+  rmw_message_info_t * message_info,
+  MessageTimestamps * timestamps,
+  rmw_subscription_allocation_t * allocation);
+
+/// Take a serialized message like rmw_take_serialized_message_with_info(), with its timestamps.
+/**
+ * \param subscription to take from
+ * \param serialized_message [out] the taken message
+ * \param taken [out] whether a message was taken
+ * \param message_info [out] filled if a message was taken
+ * \param timestamps [out] filled if a message was taken
+ * \param allocation unused
+ * \return RMW_RET_OK if successful, or
+ * \return RMW_RET_INVALID_ARGUMENT if message_info or timestamps is null, or
+ * \return RMW_RET_ERROR if an unexpected error occurs
+ */
+RMW_CONNEXT_CPP_PUBLIC
+rmw_ret_t
+take_serialized_message_with_timestamps(
+  const rmw_subscription_t * subscription,
+  rmw_serialized_message_t * serialized_message,
+  bool * taken,
+  rmw_message_info_t * message_info,
+  MessageTimestamps * timestamps,
+  rmw_subscription_allocation_t * allocation);
+
+}  // namespace rmw_connext_cpp
+
+#endif  // RMW_CONNEXT_CPP__MESSAGE_TIMESTAMPS_HPP_
@@ -0,0 +1,66 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_CPP__PUBLISHER_OPTIONS_HPP_
+#define RMW_CONNEXT_CPP__PUBLISHER_OPTIONS_HPP_
+
+#include <cstddef>
+
+#include "rmw/types.h"
+
+namespace rmw_connext_cpp
+{
+
+/// Writer side batching of samples into a single RTPS message.
+struct BatchingOptions
+{
+  /// Whether samples are batched.
+  bool enable;
+  /// Maximum number of samples in a batch, 0 for no limit.
+  size_t max_samples;
+  /// Maximum number of serialized bytes in a batch, 0 to keep the Connext default.
+  size_t max_data_bytes;
+  /// Maximum time a sample waits in an incomplete batch.
+  /**
+   * 0 for RMW_CONNEXT_BATCH_DEFAULT_MAX_FLUSH_DELAY_MS, a batch is never held back longer.
+   */
+  rmw_time_t max_flush_delay;
+};
+
+/// Connext specific options of a publisher.
+/**
+ * To use them, point `rmw_publisher_options_t::rmw_specific_publisher_payload` to an instance
+ * which outlives the call to `rmw_create_publisher()`.
+ * Batching and flow controllers can also be selected per topic through the `batch` and
+ * `publish_mode` policies of an XML QoS profile, see RMW_CONNEXT_QOS_PROFILE_ENV_VAR.
+ */
+struct PublisherOptions
+{
+  BatchingOptions batching;
+  /// Name of a flow controller defined in RMW_CONNEXT_FLOW_CONTROLLERS_ENV_VAR, or nullptr.
+  const char * flow_controller_name;
+};
+
+/// Get publisher options with every option disabled.
+inline
+PublisherOptions
+get_default_publisher_options()
+{
+  PublisherOptions options{};
+  return options;
+}
+
+}  // namespace rmw_connext_cpp
+
+#endif  // RMW_CONNEXT_CPP__PUBLISHER_OPTIONS_HPP_
@@ -0,0 +1,69 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_CPP__SUBSCRIPTION_OPTIONS_HPP_
+#define RMW_CONNEXT_CPP__SUBSCRIPTION_OPTIONS_HPP_
+
+#include <cstddef>
+
+#include "rmw/types.h"
+
+namespace rmw_connext_cpp
+{
+
+/// Connext specific options of a subscription.
+/**
+ * To use them, point `rmw_subscription_options_t::rmw_specific_subscription_payload` to an
+ * instance which outlives the call to `rmw_create_subscription()`.
+ */
+struct SubscriptionOptions
+{
+  /// SQL-like filter expression over the fields of the message, or nullptr to receive all.
+  /**
+   * The data reader is created on a content filtered topic, so that matching data writers
+   * evaluate the filter and only send the samples which pass it.
+   * Parameters are referenced as %0, %1, ... in the expression.
+   */
+  const char * filter_expression;
+  /// Initial values of the expression parameters, can be updated with
+  /// set_subscription_filter_parameters().
+  const char * const * filter_parameters;
+  /// Number of elements in filter_parameters.
+  size_t filter_parameters_count;
+  /// Minimum time between two received samples, the ones in between are dropped; 0 for all.
+  /**
+   * Maps to the time based filter policy, which matching data writers apply before sending.
+   * Has to be at most the deadline period of the subscription.
+   */
+  rmw_time_t minimum_separation;
+  /// Whether a take returns the newest available sample and drops the older ones.
+  /**
+   * Meant for state topics, the dropped samples are neither copied nor deserialized.
+   * Their number is reported by get_subscription_conflated_count().
+   */
+  bool latest_only;
+};
+
+/// Get subscription options with every option disabled.
+inline
+SubscriptionOptions
+get_default_subscription_options()
+{
+  SubscriptionOptions options{};
+  return options;
+}
+
+}  // namespace rmw_connext_cpp
+
+#endif  // RMW_CONNEXT_CPP__SUBSCRIPTION_OPTIONS_HPP_
@@ -0,0 +1,64 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_CPP__TOPIC_STATISTICS_HPP_
+#define RMW_CONNEXT_CPP__TOPIC_STATISTICS_HPP_
+
+#include "rmw/rmw.h"
+#include "rmw/types.h"
+
+#include "rmw_connext_shared_cpp/topic_statistics.hpp"
+
+#include "rmw_connext_cpp/visibility_control.h"
+
+namespace rmw_connext_cpp
+{
+
+/// Get the statistics of the messages published over the last complete window.
+/**
+ * Statistics are only computed for the topics selected by RMW_CONNEXT_TOPIC_STATISTICS_ENV_VAR
+ * when the publisher was created.
+ * Published messages have no age, so aged_messages is always 0.
+ *
+ * \param publisher publisher to get the statistics of
+ * \param snapshot [out] statistics of the last complete window
+ * \return RMW_RET_OK if successful, or
+ * \return RMW_RET_INVALID_ARGUMENT if an argument is null, or
+ * \return RMW_RET_ERROR if the publisher is not from this implementation or has no statistics
+ */
+RMW_CONNEXT_CPP_PUBLIC
+rmw_ret_t
+get_publisher_statistics(const rmw_publisher_t * publisher, TopicStatisticsSnapshot * snapshot);
+
+/// Get the statistics of the messages taken over the last complete window.
+/**
+ * Statistics are only computed for the topics selected by RMW_CONNEXT_TOPIC_STATISTICS_ENV_VAR
+ * when the subscription was created.
+ * The age of a message is measured against its source timestamp, so it includes the clock
+ * offset between the publishing and the subscribing host.
+ *
+ * \param subscription subscription to get the statistics of
+ * \param snapshot [out] statistics of the last complete window
+ * \return RMW_RET_OK if successful, or
+ * \return RMW_RET_INVALID_ARGUMENT if an argument is null, or
+ * \return RMW_RET_ERROR if the subscription is not from this implementation or has no statistics
+ */
+RMW_CONNEXT_CPP_PUBLIC
+rmw_ret_t
+get_subscription_statistics(
+  const rmw_subscription_t * subscription, TopicStatisticsSnapshot * snapshot);
+
+}  // namespace rmw_connext_cpp
+
+#endif  // RMW_CONNEXT_CPP__TOPIC_STATISTICS_HPP_
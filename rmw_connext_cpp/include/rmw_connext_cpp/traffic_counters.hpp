@@ -0,0 +1,136 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_CPP__TRAFFIC_COUNTERS_HPP_
+#define RMW_CONNEXT_CPP__TRAFFIC_COUNTERS_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "rmw/rmw.h"
+#include "rmw/types.h"
+
+#include "rmw_connext_cpp/visibility_control.h"
+
+namespace rmw_connext_cpp
+{
+
+/// Messages and bytes going through a publisher or subscription, updated lock free.
+class TrafficCounter
+{
+public:
+  /// Record a message of a given serialized size.
+  void record(size_t bytes)
+  {
+    messages_.fetch_add(1, std::memory_order_relaxed);
+    bytes_.fetch_add(bytes, std::memory_order_relaxed);
+  }
+
+  /// Record a failed publish or take.
+  void record_error()
+  {
+    errors_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  uint64_t messages() const
+  {
+    return messages_.load(std::memory_order_relaxed);
+  }
+
+  uint64_t bytes() const
+  {
+    return bytes_.load(std::memory_order_relaxed);
+  }
+
+  uint64_t errors() const
+  {
+    return errors_.load(std::memory_order_relaxed);
+  }
+
+private:
+  std::atomic<uint64_t> messages_{0};
+  std::atomic<uint64_t> bytes_{0};
+  std::atomic<uint64_t> errors_{0};
+};
+
+/// Traffic of a publisher since its creation.
+struct PublisherTrafficCounters
+{
+  /// Number of published messages.
+  uint64_t messages_sent;
+  /// Serialized size of the published messages.
+  uint64_t bytes_sent;
+  /// Number of publish calls which failed.
+  uint64_t publish_errors;
+};
+
+/// Traffic of a subscription since its creation.
+struct SubscriptionTrafficCounters
+{
+  /// Number of taken messages.
+  uint64_t messages_taken;
+  /// Serialized size of the taken messages.
+  uint64_t bytes_taken;
+  /// Number of take calls which failed.
+  uint64_t take_errors;
+  /// Number of samples dropped by latest only takes.
+  uint64_t samples_conflated;
+  /// Number of samples Connext knows were sent but never received.
+  /**
+   * Total count of the SAMPLE_LOST status. Once a sample lost event is created for the
+   * subscription, it is the total count the event last read.
+   */
+  uint64_t samples_lost;
+  /// Number of received samples the reader had no room for.
+  /**
+   * Total count of the SAMPLE_REJECTED status. Once a sample rejected event is created for the
+   * subscription, it is the total count the event last read.
+   */
+  uint64_t samples_rejected;
+};
+
+/// Get the traffic counters of a publisher.
+/**
+ * \param publisher to query
+ * \param counters [out] snapshot of the counters, each one is read atomically
+ * \return RMW_RET_OK if successful, or
+ * \return RMW_RET_INVALID_ARGUMENT if an argument is null, or
+ * \return RMW_RET_ERROR if the publisher is not from this implementation
+ */
+RMW_CONNEXT_CPP_PUBLIC
+rmw_ret_t
+get_publisher_traffic_counters(
+  const rmw_publisher_t * publisher, PublisherTrafficCounters * counters);
+
+/// Get the traffic counters of a subscription.
+/**
+ * Only reads the sample lost and rejected statuses which have no event, so it doesn't clear
+ * the changed status an event waits for.
+ *
+ * \param subscription to query
+ * \param counters [out] snapshot of the counters, each one is read atomically
+ * \return RMW_RET_OK if successful, or
+ * \return RMW_RET_INVALID_ARGUMENT if an argument is null, or
+ * \return RMW_RET_ERROR if the subscription is not from this implementation or a status
+ *   can't be read
+ */
+RMW_CONNEXT_CPP_PUBLIC
+rmw_ret_t
+get_subscription_traffic_counters(
+  const rmw_subscription_t * subscription, SubscriptionTrafficCounters * counters);
+
+}  // namespace rmw_connext_cpp
+
+#endif  // RMW_CONNEXT_CPP__TRAFFIC_COUNTERS_HPP_
@@ -0,0 +1,43 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/error_handling.h"
+#include "rmw/impl/cpp/macros.hpp"
+
+#include "rmw_connext_cpp/conflation.hpp"
+#include "rmw_connext_cpp/connext_static_subscriber_info.hpp"
+#include "rmw_connext_cpp/identifier.hpp"
+
+namespace rmw_connext_cpp
+{
+
+rmw_ret_t
+get_subscription_conflated_count(const rmw_subscription_t * subscription, uint64_t * count)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(subscription, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(count, RMW_RET_INVALID_ARGUMENT);
+  if (subscription->implementation_identifier != rti_connext_identifier) {
+    RMW_SET_ERROR_MSG("subscription handle is not from this rmw implementation");
+    return RMW_RET_ERROR;
+  }
+  auto info = static_cast<ConnextStaticSubscriberInfo *>(subscription->data);
+  if (!info) {
+    RMW_SET_ERROR_MSG("subscription internal data is invalid");
+    return RMW_RET_ERROR;
+  }
+  *count = info->conflated_count_.load(std::memory_order_relaxed);
+  return RMW_RET_OK;
+}
+
+}  // namespace rmw_connext_cpp
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "rmw_connext_cpp/connext_static_subscriber_info.hpp"
+#include "rmw_connext_shared_cpp/connext_event_types.hpp"
 #include "rmw_connext_shared_cpp/event_converter.hpp"
 
 rmw_ret_t ConnextStaticSubscriberInfo::get_status(
@@ -58,6 +59,66 @@ rmw_ret_t ConnextStaticSubscriberInfo::get_status(
         rmw_requested_deadline_missed_status->total_count_change =
           requested_deadline_missed.total_count_change;
 
+        break;
+      }
+    case DDS::StatusKind::DDS_SAMPLE_LOST_STATUS:
+      {
+        // only read the status of this event, reading a status clears its changed bit
+        DDS::SampleLostStatus sample_lost;
+        DDS::ReturnCode_t dds_return_code =
+          sample_status_totals_.read_status(topic_reader_, sample_lost);
+
+        rmw_ret_t from_dds = check_dds_ret_code(dds_return_code);
+        if (from_dds != RMW_RET_OK) {
+          return from_dds;
+        }
+
+        auto rmw_sample_lost_status = static_cast<rmw_connext_sample_lost_status_t *>(event);
+        rmw_sample_lost_status->total_count = sample_lost.total_count;
+        rmw_sample_lost_status->total_count_change = sample_lost.total_count_change;
+
+        break;
+      }
+    case DDS::StatusKind::DDS_SAMPLE_REJECTED_STATUS:
+      {
+        DDS::SampleRejectedStatus sample_rejected;
+        DDS::ReturnCode_t dds_return_code =
+          sample_status_totals_.read_status(topic_reader_, sample_rejected);
+
+        rmw_ret_t from_dds = check_dds_ret_code(dds_return_code);
+        if (from_dds != RMW_RET_OK) {
+          return from_dds;
+        }
+
+        auto rmw_sample_rejected_status =
+          static_cast<rmw_connext_sample_rejected_status_t *>(event);
+        rmw_sample_rejected_status->total_count = sample_rejected.total_count;
+        rmw_sample_rejected_status->total_count_change = sample_rejected.total_count_change;
+        rmw_sample_rejected_status->last_reason =
+          get_sample_rejected_reason_name(sample_rejected.last_reason);
+
+        break;
+      }
+    case DDS::StatusKind::DDS_REQUESTED_INCOMPATIBLE_QOS_STATUS:
+      {
+        DDS::RequestedIncompatibleQosStatus requested_incompatible_qos;
+        DDS::ReturnCode_t dds_return_code =
+          topic_reader_->get_requested_incompatible_qos_status(requested_incompatible_qos);
+
+        rmw_ret_t from_dds = check_dds_ret_code(dds_return_code);
+        if (from_dds != RMW_RET_OK) {
+          return from_dds;
+        }
+
+        auto rmw_requested_incompatible_qos_status =
+          static_cast<rmw_connext_requested_incompatible_qos_status_t *>(event);
+        rmw_requested_incompatible_qos_status->total_count =
+          requested_incompatible_qos.total_count;
+        rmw_requested_incompatible_qos_status->total_count_change =
+          requested_incompatible_qos.total_count_change;
+        rmw_requested_incompatible_qos_status->last_policy_name =
+          get_qos_policy_name(requested_incompatible_qos.last_policy_id);
+
         break;
       }
     default:
@@ -0,0 +1,83 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/error_handling.h"
+#include "rmw/impl/cpp/macros.hpp"
+
+#include "rmw_connext_cpp/connext_static_subscriber_info.hpp"
+#include "rmw_connext_cpp/content_filter.hpp"
+#include "rmw_connext_cpp/identifier.hpp"
+
+namespace rmw_connext_cpp
+{
+
+bool
+fill_filter_parameters(
+  const char * const * parameters, size_t count, DDS::StringSeq & sequence)
+{
+  if (count > 0 && !parameters) {
+    RMW_SET_ERROR_MSG("filter parameters are null");
+    return false;
+  }
+  if (!sequence.ensure_length(static_cast<DDS::Long>(count), static_cast<DDS::Long>(count))) {
+    RMW_SET_ERROR_MSG("failed to allocate filter parameters");
+    return false;
+  }
+  for (size_t i = 0; i < count; ++i) {
+    if (!parameters[i]) {
+      RMW_SET_ERROR_MSG("filter parameter is null");
+      return false;
+    }
+    if (!DDS_String_replace(&sequence[static_cast<DDS::Long>(i)], parameters[i])) {
+      RMW_SET_ERROR_MSG("failed to copy filter parameter");
+      return false;
+    }
+  }
+  return true;
+}
+
+rmw_ret_t
+set_subscription_filter_parameters(
+  const rmw_subscription_t * subscription, const char * const * parameters, size_t count)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(subscription, RMW_RET_INVALID_ARGUMENT);
+  if (count > 0) {
+    RMW_CHECK_ARGUMENT_FOR_NULL(parameters, RMW_RET_INVALID_ARGUMENT);
+  }
+  if (subscription->implementation_identifier != rti_connext_identifier) {
+    RMW_SET_ERROR_MSG("subscription handle is not from this rmw implementation");
+    return RMW_RET_ERROR;
+  }
+  auto info = static_cast<ConnextStaticSubscriberInfo *>(subscription->data);
+  if (!info) {
+    RMW_SET_ERROR_MSG("subscription internal data is invalid");
+    return RMW_RET_ERROR;
+  }
+  if (!info->content_filtered_topic_) {
+    RMW_SET_ERROR_MSG("subscription was not created with a filter expression");
+    return RMW_RET_ERROR;
+  }
+  DDS::StringSeq sequence;
+  if (!fill_filter_parameters(parameters, count, sequence)) {
+    // error string was set within the function
+    return RMW_RET_ERROR;
+  }
+  if (info->content_filtered_topic_->set_expression_parameters(sequence) != DDS::RETCODE_OK) {
+    RMW_SET_ERROR_MSG("failed to set filter expression parameters");
+    return RMW_RET_ERROR;
+  }
+  return RMW_RET_OK;
+}
+
+}  // namespace rmw_connext_cpp
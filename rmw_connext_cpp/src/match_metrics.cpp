@@ -0,0 +1,61 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/error_handling.h"
+
+#include "rmw_connext_cpp/connext_static_publisher_info.hpp"
+#include "rmw_connext_cpp/connext_static_subscriber_info.hpp"
+#include "rmw_connext_cpp/identifier.hpp"
+#include "rmw_connext_cpp/match_metrics.hpp"
+
+namespace rmw_connext_cpp
+{
+
+rmw_ret_t
+get_publisher_match_metrics(const rmw_publisher_t * publisher, MatchMetrics * metrics)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(publisher, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(metrics, RMW_RET_INVALID_ARGUMENT);
+  if (publisher->implementation_identifier != rti_connext_identifier) {
+    RMW_SET_ERROR_MSG("publisher handle is not from this rmw implementation");
+    return RMW_RET_ERROR;
+  }
+  auto info = static_cast<ConnextStaticPublisherInfo *>(publisher->data);
+  if (!info || !info->listener_) {
+    RMW_SET_ERROR_MSG("publisher internal listener is invalid");
+    return RMW_RET_ERROR;
+  }
+  info->listener_->match_recorder().get_metrics(*metrics);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+get_subscription_match_metrics(const rmw_subscription_t * subscription, MatchMetrics * metrics)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(subscription, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(metrics, RMW_RET_INVALID_ARGUMENT);
+  if (subscription->implementation_identifier != rti_connext_identifier) {
+    RMW_SET_ERROR_MSG("subscription handle is not from this rmw implementation");
+    return RMW_RET_ERROR;
+  }
+  auto info = static_cast<ConnextStaticSubscriberInfo *>(subscription->data);
+  if (!info || !info->listener_) {
+    RMW_SET_ERROR_MSG("subscription internal listener is invalid");
+    return RMW_RET_ERROR;
+  }
+  info->listener_->match_recorder().get_metrics(*metrics);
+  return RMW_RET_OK;
+}
+
+}  // namespace rmw_connext_cpp
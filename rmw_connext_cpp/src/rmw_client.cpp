@@ -19,8 +19,10 @@
 #include "rmw/impl/cpp/macros.hpp"
 #include "rmw/rmw.h"
 
+#include "rmw_connext_shared_cpp/discovery_timeline.hpp"
 #include "rmw_connext_shared_cpp/types.hpp"
 #include "rmw_connext_shared_cpp/qos.hpp"
+#include "rmw_connext_shared_cpp/sample_size.hpp"
 
 #include "rmw_connext_cpp/connext_static_client_info.hpp"
 #include "rmw_connext_cpp/identifier.hpp"
@@ -104,23 +106,29 @@ rmw_create_client(
     goto fail;
   }
 
-  if (!get_datareader_qos(participant, *qos_profile, datareader_qos)) {
-    // error string was set within the function
+  // allocating memory for request topic and response topic strings
+  if (!_process_service_name(
+      service_name,
+      qos_profile->avoid_ros_namespace_conventions,
+      &request_topic_str,
+      &response_topic_str))
+  {
     goto fail;
   }
 
-  if (!get_datawriter_qos(participant, *qos_profile, datawriter_qos)) {
+  if (!get_datareader_qos(
+      participant, *qos_profile, response_topic_str, RMW_CONNEXT_DEFAULT_POOL_BUFFER_MAX_SIZE, 0,
+      datareader_qos))
+  {
     // error string was set within the function
     goto fail;
   }
 
-  // allocating memory for request topic and response topic strings
-  if (!_process_service_name(
-      service_name,
-      qos_profile->avoid_ros_namespace_conventions,
-      &request_topic_str,
-      &response_topic_str))
+  if (!get_datawriter_qos(
+      participant, *qos_profile, request_topic_str, RMW_CONNEXT_DEFAULT_POOL_BUFFER_MAX_SIZE,
+      datawriter_qos))
   {
+    // error string was set within the function
     goto fail;
   }
 
@@ -205,6 +213,10 @@ rmw_create_client(
     goto fail;
   }
   dds_qos_to_rmw_qos(datareader_qos, &actual_qos_profile);
+  record_discovery_event(
+    DiscoveryEvent::LocalSubscriberCreated,
+    response_datareader->get_instance_handle(),
+    mangled_name.c_str());
   node_info->subscriber_listener->add_information(
     node_info->participant->get_instance_handle(),
     response_datareader->get_instance_handle(),
@@ -221,6 +233,10 @@ rmw_create_client(
     goto fail;
   }
   dds_qos_to_rmw_qos(datawriter_qos, &actual_qos_profile);
+  record_discovery_event(
+    DiscoveryEvent::LocalPublisherCreated,
+    request_datawriter->get_instance_handle(),
+    mangled_name.c_str());
   node_info->publisher_listener->add_information(
     node_info->participant->get_instance_handle(),
     request_datawriter->get_instance_handle(),
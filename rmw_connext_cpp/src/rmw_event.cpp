@@ -15,7 +15,9 @@
 #include "rmw/rmw.h"
 
 #include "rmw_connext_shared_cpp/event.hpp"
+#include "rmw_connext_shared_cpp/event_converter.hpp"
 
+#include "rmw_connext_cpp/connext_static_subscriber_info.hpp"
 #include "rmw_connext_cpp/identifier.hpp"
 
 extern "C"
@@ -40,12 +42,18 @@ rmw_subscription_event_init(
   const rmw_subscription_t * subscription,
   rmw_event_type_t event_type)
 {
-  return __rmw_init_event(
+  rmw_ret_t ret = __rmw_init_event(
     rti_connext_identifier,
     rmw_event,
     subscription->implementation_identifier,
     subscription->data,
     event_type);
+  if (ret == RMW_RET_OK) {
+    // from now on only the event reads its status, so waiting on the event still works
+    auto info = static_cast<ConnextStaticSubscriberInfo *>(subscription->data);
+    info->sample_status_totals_.attach_event(get_status_kind_from_rmw(event_type));
+  }
+  return ret;
 }
 
 rmw_ret_t
@@ -18,6 +18,8 @@
 #include "rmw/rmw.h"
 #include "rmw/types.h"
 
+#include "rmw_connext_shared_cpp/tracing.hpp"
+
 #include "rmw_connext_cpp/connext_static_publisher_info.hpp"
 #include "rmw_connext_cpp/identifier.hpp"
 
@@ -113,6 +115,7 @@ rmw_publish(
   rcutils_uint8_array_t cdr_stream = rcutils_get_zero_initialized_uint8_array();
   cdr_stream.allocator = rcutils_get_default_allocator();
 
+  RMW_CONNEXT_TRACE_TIMESTAMP(serialize_start);
   if (!callbacks->to_cdr_stream(ros_message, &cdr_stream)) {
     RMW_SET_ERROR_MSG("failed to convert ros_message to cdr stream");
     ret = RMW_RET_ERROR;
@@ -128,10 +131,23 @@ rmw_publish(
     ret = RMW_RET_ERROR;
     goto fail;
   }
-  if (!publish(topic_writer, &cdr_stream)) {
-    RMW_SET_ERROR_MSG("failed to publish message");
-    ret = RMW_RET_ERROR;
-    goto fail;
+  {
+    RMW_CONNEXT_TRACE_TIMESTAMP(write_start);
+    if (!publish(topic_writer, &cdr_stream)) {
+      RMW_SET_ERROR_MSG("failed to publish message");
+      publisher_info->traffic_counter_.record_error();
+      ret = RMW_RET_ERROR;
+      goto fail;
+    }
+    RMW_CONNEXT_TRACE_TIMESTAMP(write_end);
+    RMW_CONNEXT_TRACEPOINT(
+      publish, publisher, ros_message, cdr_stream.buffer_length, write_start,
+      write_start - serialize_start, write_end - write_start);
+  }
+  publisher_info->sample_size_record_->record(cdr_stream.buffer_length);
+  publisher_info->traffic_counter_.record(cdr_stream.buffer_length);
+  if (publisher_info->statistics_enabled_) {
+    publisher_info->statistics_.record(TopicStatistics::Clock::now(), cdr_stream.buffer_length, -1);
   }
 
 fail:
@@ -176,11 +192,23 @@ rmw_publish_serialized_message(
     return RMW_RET_ERROR;
   }
 
+  RMW_CONNEXT_TRACE_TIMESTAMP(write_start);
   bool published = publish(topic_writer, serialized_message);
+  RMW_CONNEXT_TRACE_TIMESTAMP(write_end);
   if (!published) {
     RMW_SET_ERROR_MSG("failed to publish message");
+    publisher_info->traffic_counter_.record_error();
     return RMW_RET_ERROR;
   }
+  RMW_CONNEXT_TRACEPOINT(
+    publish, publisher, serialized_message, serialized_message->buffer_length, write_start,
+    0, write_end - write_start);
+  publisher_info->sample_size_record_->record(serialized_message->buffer_length);
+  publisher_info->traffic_counter_.record(serialized_message->buffer_length);
+  if (publisher_info->statistics_enabled_) {
+    publisher_info->statistics_.record(
+      TopicStatistics::Clock::now(), serialized_message->buffer_length, -1);
+  }
   return RMW_RET_OK;
 }
 
@@ -14,16 +14,22 @@
 
 #include <string>
 
+#include "rcutils/logging_macros.h"
+
 #include "rmw/allocators.h"
 #include "rmw/error_handling.h"
 #include "rmw/impl/cpp/macros.hpp"
 #include "rmw/rmw.h"
 #include "rmw/types.h"
 
+#include "rmw_connext_shared_cpp/discovery_timeline.hpp"
 #include "rmw_connext_shared_cpp/qos.hpp"
+#include "rmw_connext_shared_cpp/sample_size.hpp"
+#include "rmw_connext_shared_cpp/topic_statistics.hpp"
 #include "rmw_connext_shared_cpp/types.hpp"
 
 #include "rmw_connext_cpp/identifier.hpp"
+#include "rmw_connext_cpp/publisher_options.hpp"
 
 #include "process_topic_and_service_names.hpp"
 #include "type_support_common.hpp"
@@ -114,6 +120,8 @@ rmw_create_publisher(
     return NULL;
   }
   std::string type_name = _create_type_name(callbacks);
+  auto connext_options = static_cast<const rmw_connext_cpp::PublisherOptions *>(
+    publisher_options->rmw_specific_publisher_payload);
   // Past this point, a failure results in unrolling code in the goto fail block.
   DDS::TypeCode * type_code = nullptr;
   DDS::DataWriterQos datawriter_qos;
@@ -130,6 +138,9 @@ rmw_create_publisher(
   rmw_publisher_t * publisher = nullptr;
   std::string mangled_name = "";
   rmw_qos_profile_t actual_qos_profile;
+  SampleSizeRecord * sample_size_record = nullptr;
+  size_t pool_buffer_max_size = 0;
+  const DDS::Property_t * pool_buffer_max_size_property = nullptr;
 
   char * topic_str = nullptr;
 
@@ -146,6 +157,10 @@ rmw_create_publisher(
     RMW_SET_ERROR_MSG("failed to fetch type code\n");
     goto fail;
   }
+  // size the sample pool for the largest sample of the type, or the largest one seen so far
+  sample_size_record = get_sample_size_record(type_name);
+  pool_buffer_max_size = get_pool_buffer_max_size(
+    get_max_serialized_size(type_code), sample_size_record->get());
   // This is a non-standard RTI Connext function
   // It allows to register an external type to a static data writer
   // In this case, we register the custom message type to a data writer,
@@ -216,13 +231,31 @@ rmw_create_publisher(
       goto fail;
     }
   }
-  DDS::String_free(topic_str);
-  topic_str = nullptr;
 
-  if (!get_datawriter_qos(participant, *qos_profile, datawriter_qos)) {
+  if (!get_datawriter_qos(
+      participant, *qos_profile, topic_str, pool_buffer_max_size, datawriter_qos))
+  {
     // error string was set within the function
     goto fail;
   }
+  if (connext_options && connext_options->batching.enable) {
+    const rmw_connext_cpp::BatchingOptions & batching = connext_options->batching;
+    if (!set_batch_qos(
+        batching.max_samples, batching.max_data_bytes, batching.max_flush_delay,
+        datawriter_qos.batch))
+    {
+      // error string was set within the function
+      goto fail;
+    }
+  }
+  if (connext_options && connext_options->flow_controller_name &&
+    !set_flow_controller_qos(connext_options->flow_controller_name, datawriter_qos))
+  {
+    // error string was set within the function
+    goto fail;
+  }
+  DDS::String_free(topic_str);
+  topic_str = nullptr;
 
   topic_writer = dds_publisher->create_datawriter(
     topic, datawriter_qos, NULL, DDS::STATUS_MASK_NONE);
@@ -243,6 +276,8 @@ rmw_create_publisher(
   publisher_info->dds_publisher_ = dds_publisher;
   publisher_info->topic_writer_ = topic_writer;
   publisher_info->callbacks_ = callbacks;
+  publisher_info->sample_size_record_ = sample_size_record;
+  publisher_info->statistics_enabled_ = is_topic_statistics_enabled(topic_name);
   publisher_info->publisher_gid.implementation_identifier = rti_connext_identifier;
   publisher_info->listener_ = publisher_listener;
   publisher_listener = nullptr;
@@ -280,6 +315,17 @@ rmw_create_publisher(
     goto fail;
   }
   dds_qos_to_rmw_qos(datawriter_qos, &actual_qos_profile);
+  pool_buffer_max_size_property = DDS::PropertyQosPolicyHelper::lookup_property(
+    datawriter_qos.property,
+    "dds.data_writer.history.memory_manager.fast_pool.pool_buffer_max_size");
+  RCUTILS_LOG_DEBUG_NAMED(
+    "rmw_connext_cpp", "publisher on '%s' uses a sample pool buffer size of %s bytes",
+    mangled_name.c_str(),
+    pool_buffer_max_size_property ? pool_buffer_max_size_property->value : "unknown");
+  record_discovery_event(
+    DiscoveryEvent::LocalPublisherCreated,
+    topic_writer->get_instance_handle(),
+    mangled_name.c_str());
   node_info->publisher_listener->add_information(
     node_info->participant->get_instance_handle(),
     dds_publisher->get_instance_handle(),
@@ -16,6 +16,8 @@
 #include "rmw/impl/cpp/macros.hpp"
 #include "rmw/rmw.h"
 
+#include "rmw_connext_shared_cpp/tracing.hpp"
+
 #include "rmw_connext_cpp/identifier.hpp"
 #include "rmw_connext_cpp/connext_static_client_info.hpp"
 #include "rmw_connext_cpp/connext_static_service_info.hpp"
@@ -58,7 +60,12 @@ rmw_send_request(
     return RMW_RET_ERROR;
   }
 
+  // the type support serializes and writes the request in one call
+  RMW_CONNEXT_TRACE_TIMESTAMP(send_start);
   *sequence_id = callbacks->send_request(requester, ros_request);
+  RMW_CONNEXT_TRACE_TIMESTAMP(send_end);
+  RMW_CONNEXT_TRACEPOINT(
+    send_request, client, ros_request, *sequence_id, send_start, send_end - send_start);
   return RMW_RET_OK;
 }
 
@@ -16,6 +16,8 @@
 #include "rmw/impl/cpp/macros.hpp"
 #include "rmw/rmw.h"
 
+#include "rmw_connext_shared_cpp/tracing.hpp"
+
 #include "rmw_connext_cpp/identifier.hpp"
 #include "rmw_connext_cpp/connext_static_client_info.hpp"
 #include "rmw_connext_cpp/connext_static_service_info.hpp"
@@ -70,7 +72,13 @@ rmw_take_response(
     return RMW_RET_ERROR;
   }
 
+  // the type support takes and deserializes the response in one call
+  RMW_CONNEXT_TRACE_TIMESTAMP(take_start);
   *taken = callbacks->take_response(requester, request_header, ros_response);
+  RMW_CONNEXT_TRACE_TIMESTAMP(take_end);
+  RMW_CONNEXT_TRACEPOINT(
+    take_response, client, ros_response, *taken, request_header->sequence_number, take_start,
+    take_end - take_start);
 
   return RMW_RET_OK;
 }
@@ -12,17 +12,25 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
 #include <string>
 
+#include "rcutils/logging_macros.h"
+
 #include "rmw/allocators.h"
 #include "rmw/error_handling.h"
 #include "rmw/impl/cpp/macros.hpp"
 #include "rmw/rmw.h"
 
+#include "rmw_connext_shared_cpp/discovery_timeline.hpp"
 #include "rmw_connext_shared_cpp/qos.hpp"
+#include "rmw_connext_shared_cpp/sample_size.hpp"
+#include "rmw_connext_shared_cpp/topic_statistics.hpp"
 #include "rmw_connext_shared_cpp/types.hpp"
 
+#include "rmw_connext_cpp/content_filter.hpp"
 #include "rmw_connext_cpp/identifier.hpp"
+#include "rmw_connext_cpp/subscription_options.hpp"
 
 #include "process_topic_and_service_names.hpp"
 #include "type_support_common.hpp"
@@ -108,6 +116,8 @@ rmw_create_subscription(
     return NULL;
   }
   std::string type_name = _create_type_name(callbacks);
+  auto connext_options = static_cast<const rmw_connext_cpp::SubscriptionOptions *>(
+    subscription_options->rmw_specific_subscription_payload);
   // Past this point, a failure results in unrolling code in the goto fail block.
   DDS::TypeCode * type_code = nullptr;
   DDS::DataReaderQos datareader_qos;
@@ -116,6 +126,7 @@ rmw_create_subscription(
   DDS::Subscriber * dds_subscriber = nullptr;
   DDS::Topic * topic = nullptr;
   DDS::TopicDescription * topic_description = nullptr;
+  DDS::ContentFilteredTopic * content_filtered_topic = nullptr;
   DDS::DataReader * topic_reader = nullptr;
   DDS::ReadCondition * read_condition = nullptr;
   void * info_buf = nullptr;
@@ -125,6 +136,10 @@ rmw_create_subscription(
   rmw_subscription_t * subscription = nullptr;
   std::string mangled_name;
   rmw_qos_profile_t actual_qos_profile;
+  SampleSizeRecord * sample_size_record = nullptr;
+  size_t max_serialized_size = 0;
+  size_t pool_buffer_max_size = 0;
+  const DDS::Property_t * pool_buffer_max_size_property = nullptr;
 
   char * topic_str = nullptr;
 
@@ -140,6 +155,11 @@ rmw_create_subscription(
     RMW_SET_ERROR_MSG("failed to fetch type code\n");
     goto fail;
   }
+  // size the sample pool for the largest sample of the type, or the largest one seen so far
+  sample_size_record = get_sample_size_record(type_name);
+  max_serialized_size = get_max_serialized_size(type_code);
+  pool_buffer_max_size = get_pool_buffer_max_size(
+    max_serialized_size, sample_size_record->get());
   // This is a non-standard RTI Connext function
   // It allows to register an external type to a static data writer
   // In this case, we register the custom message type to a data writer,
@@ -210,17 +230,54 @@ rmw_create_subscription(
       goto fail;
     }
   }
-  DDS::String_free(topic_str);
-  topic_str = nullptr;
 
-  if (!get_datareader_qos(participant, *qos_profile, datareader_qos)) {
+  if (!get_datareader_qos(
+      participant, *qos_profile, topic_str, pool_buffer_max_size, max_serialized_size,
+      datareader_qos))
+  {
     // error string was set within the function
     goto fail;
   }
+  if (connext_options &&
+    !set_time_based_filter_qos(connext_options->minimum_separation, datareader_qos))
+  {
+    // error string was set within the function
+    goto fail;
+  }
+
+  if (connext_options && connext_options->filter_expression) {
+    // The writers evaluate the filter, the name of the filtered topic is local to the
+    // participant and only has to be unique.
+    static std::atomic<uint64_t> filtered_topic_count(0);
+    std::string filtered_topic_name =
+      std::string(topic_str) + "__cft_" + std::to_string(filtered_topic_count++);
+    DDS::StringSeq filter_parameters;
+    if (!rmw_connext_cpp::fill_filter_parameters(
+        connext_options->filter_parameters, connext_options->filter_parameters_count,
+        filter_parameters))
+    {
+      // error string was set within the function
+      goto fail;
+    }
+    content_filtered_topic = participant->create_contentfilteredtopic(
+      filtered_topic_name.c_str(), topic, connext_options->filter_expression, filter_parameters);
+    if (!content_filtered_topic) {
+      RMW_SET_ERROR_MSG("failed to create content filtered topic");
+      goto fail;
+    }
+  }
+  DDS::String_free(topic_str);
+  topic_str = nullptr;
 
-  topic_reader = dds_subscriber->create_datareader(
-    topic, datareader_qos,
-    NULL, DDS::STATUS_MASK_NONE);
+  if (content_filtered_topic) {
+    topic_reader = dds_subscriber->create_datareader(
+      content_filtered_topic, datareader_qos,
+      NULL, DDS::STATUS_MASK_NONE);
+  } else {
+    topic_reader = dds_subscriber->create_datareader(
+      topic, datareader_qos,
+      NULL, DDS::STATUS_MASK_NONE);
+  }
   if (!topic_reader) {
     RMW_SET_ERROR_MSG("failed to create datareader");
     goto fail;
@@ -244,8 +301,13 @@ rmw_create_subscription(
   info_buf = nullptr;  // Only free the subscriber_info pointer; don't need the buf pointer anymore.
   subscriber_info->dds_subscriber_ = dds_subscriber;
   subscriber_info->topic_reader_ = topic_reader;
+  subscriber_info->content_filtered_topic_ = content_filtered_topic;
   subscriber_info->read_condition_ = read_condition;
   subscriber_info->callbacks_ = callbacks;
+  subscriber_info->sample_size_record_ = sample_size_record;
+  subscriber_info->latest_only_ = connext_options && connext_options->latest_only;
+  subscriber_info->conflated_count_ = 0;
+  subscriber_info->statistics_enabled_ = is_topic_statistics_enabled(topic_name);
   subscriber_info->listener_ = subscriber_listener;
   subscriber_listener = nullptr;
 
@@ -263,7 +325,7 @@ rmw_create_subscription(
   subscription->options = *subscription_options;
 
   if (!qos_profile->avoid_ros_namespace_conventions) {
-    mangled_name = topic_reader->get_topicdescription()->get_name();
+    mangled_name = topic->get_name();
   } else {
     mangled_name = topic_name;
   }
@@ -273,6 +335,17 @@ rmw_create_subscription(
     goto fail;
   }
   dds_qos_to_rmw_qos(datareader_qos, &actual_qos_profile);
+  pool_buffer_max_size_property = DDS::PropertyQosPolicyHelper::lookup_property(
+    datareader_qos.property,
+    "dds.data_reader.history.memory_manager.fast_pool.pool_buffer_max_size");
+  RCUTILS_LOG_DEBUG_NAMED(
+    "rmw_connext_cpp", "subscription on '%s' uses a sample pool buffer size of %s bytes",
+    mangled_name.c_str(),
+    pool_buffer_max_size_property ? pool_buffer_max_size_property->value : "unknown");
+  record_discovery_event(
+    DiscoveryEvent::LocalSubscriberCreated,
+    topic_reader->get_instance_handle(),
+    mangled_name.c_str());
   node_info->subscriber_listener->add_information(
     node_info->participant->get_instance_handle(),
     dds_subscriber->get_instance_handle(),
@@ -285,7 +358,7 @@ rmw_create_subscription(
 // TODO(karsten1987): replace this block with logging macros
 #ifdef DISCOVERY_DEBUG_LOGGING
   fprintf(stderr, "******* Creating Subscriber Details: ********\n");
-  fprintf(stderr, "Subscriber topic %s\n", topic_reader->get_topicdescription()->get_name());
+  fprintf(stderr, "Subscriber topic %s\n", topic->get_name());
   fprintf(stderr, "Subscriber address %p\n", static_cast<void *>(dds_subscriber));
   fprintf(stderr, "******\n");
 #endif
@@ -325,6 +398,14 @@ fail:
       (std::cerr << ss.str()).flush();
     }
   }
+  if (content_filtered_topic) {
+    if (participant->delete_contentfilteredtopic(content_filtered_topic) != DDS::RETCODE_OK) {
+      std::stringstream ss;
+      ss << "leaking content filtered topic while handling failure at " <<
+        __FILE__ << ":" << __LINE__ << '\n';
+      (std::cerr << ss.str()).flush();
+    }
+  }
   if (subscriber_listener) {
     RMW_TRY_DESTRUCTOR_FROM_WITHIN_FAILURE(
       subscriber_listener->~ConnextSubscriberListener(), ConnextSubscriberListener)
@@ -479,6 +560,15 @@ rmw_destroy_subscription(rmw_node_t * node, rmw_subscription_t * subscription)
       RMW_SET_ERROR_MSG("cannot delete datareader because the subscriber is null");
       result = RMW_RET_ERROR;
     }
+    // the content filtered topic can only be deleted once its datareader is gone
+    auto content_filtered_topic = subscriber_info->content_filtered_topic_;
+    if (content_filtered_topic && !subscriber_info->topic_reader_) {
+      if (participant->delete_contentfilteredtopic(content_filtered_topic) != DDS::RETCODE_OK) {
+        RMW_SET_ERROR_MSG("failed to delete content filtered topic");
+        result = RMW_RET_ERROR;
+      }
+      subscriber_info->content_filtered_topic_ = nullptr;
+    }
     RMW_TRY_DESTRUCTOR(
       subscriber_info->~ConnextStaticSubscriberInfo(),
       ConnextStaticSubscriberInfo, result = RMW_RET_ERROR)
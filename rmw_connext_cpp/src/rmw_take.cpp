@@ -12,28 +12,51 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
 #include <limits>
 
 #include "rmw/error_handling.h"
 #include "rmw/impl/cpp/macros.hpp"
 #include "rmw/types.h"
 
+#include "rmw_connext_shared_cpp/tracing.hpp"
 #include "rmw_connext_shared_cpp/types.hpp"
 
 #include "rmw_connext_cpp/connext_static_subscriber_info.hpp"
 #include "rmw_connext_cpp/identifier.hpp"
+#include "rmw_connext_cpp/message_timestamps.hpp"
 
 // include patched generated code from the build folder
 #include "./connext_static_serialized_dataSupport.h"
 #include "./connext_static_serialized_data.h"
 
+// Compare the lower 12 octets of the guids from the sender and this receiver,
+// if they are equal the sample has been sent from this process.
+static bool
+is_local_publication(DDS::DataReader * dds_data_reader, const DDS::SampleInfo & sample_info)
+{
+  DDS::GUID_t sender_guid = sample_info.original_publication_virtual_guid;
+  DDS::InstanceHandle_t receiver_instance_handle = dds_data_reader->get_instance_handle();
+  for (size_t i = 0; i < 12; ++i) {
+    DDS::Octet * sender_element = &(sender_guid.value[i]);
+    DDS::Octet * receiver_element =
+      &(reinterpret_cast<DDS::Octet *>(&receiver_instance_handle)[i]);
+    if (*sender_element != *receiver_element) {
+      return false;
+    }
+  }
+  return true;
+}
+
 static bool
 take(
   DDS::DataReader * dds_data_reader,
   bool ignore_local_publications,
+  bool latest_only,
   rcutils_uint8_array_t * cdr_stream,
   bool * taken,
-  void * sending_publication_handle,
+  size_t * conflated_count,
+  DDS::SampleInfo * taken_sample_info,
   rmw_subscription_allocation_t * allocation)
 {
   (void) allocation;
@@ -49,6 +72,10 @@ take(
     RMW_SET_ERROR_MSG("taken handle is null");
     return false;
   }
+  if (!conflated_count) {
+    RMW_SET_ERROR_MSG("conflated count handle is null");
+    return false;
+  }
 
   ConnextStaticSerializedDataDataReader * data_reader =
     ConnextStaticSerializedDataDataReader::narrow(dds_data_reader);
@@ -59,12 +86,13 @@ take(
 
   ConnextStaticSerializedDataSeq dds_messages;
   DDS::SampleInfoSeq sample_infos;
-  bool ignore_sample = false;
+  *conflated_count = 0;
 
+  // in latest only mode all samples are taken at once, only the newest one is used
   DDS::ReturnCode_t status = data_reader->take(
     dds_messages,
     sample_infos,
-    1,
+    latest_only ? DDS::LENGTH_UNLIMITED : 1,
     DDS::ANY_SAMPLE_STATE,
     DDS::ANY_VIEW_STATE,
     DDS::ANY_INSTANCE_STATE);
@@ -79,33 +107,32 @@ take(
     return false;
   }
 
-  DDS::SampleInfo & sample_info = sample_infos[0];
-  if (!sample_info.valid_data) {
-    // skip sample without data
-    ignore_sample = true;
-  } else if (ignore_local_publications) {
-    // compare the lower 12 octets of the guids from the sender and this receiver
-    // if they are equal the sample has been sent from this process and should be ignored
-    DDS::GUID_t sender_guid = sample_info.original_publication_virtual_guid;
-    DDS::InstanceHandle_t receiver_instance_handle = dds_data_reader->get_instance_handle();
-    ignore_sample = true;
-    for (size_t i = 0; i < 12; ++i) {
-      DDS::Octet * sender_element = &(sender_guid.value[i]);
-      DDS::Octet * receiver_element =
-        &(reinterpret_cast<DDS::Octet *>(&receiver_instance_handle)[i]);
-      if (*sender_element != *receiver_element) {
-        ignore_sample = false;
-        break;
-      }
+  // the samples are ordered from the oldest to the newest, look for the newest one to use
+  DDS::Long index = sample_infos.length() - 1;
+  for (; index >= 0; --index) {
+    const DDS::SampleInfo & sample_info = sample_infos[index];
+    // skip samples without data
+    if (!sample_info.valid_data) {
+      continue;
+    }
+    if (taken_sample_info) {
+      *taken_sample_info = sample_info;
+    }
+    if (!ignore_local_publications || !is_local_publication(dds_data_reader, sample_info)) {
+      break;
     }
   }
-  if (sample_info.valid_data && sending_publication_handle) {
-    *static_cast<DDS::InstanceHandle_t *>(sending_publication_handle) =
-      sample_info.publication_handle;
+  // the older samples are dropped without copying or deserializing them
+  for (DDS::Long i = 0; i < index; ++i) {
+    if (sample_infos[i].valid_data &&
+      (!ignore_local_publications || !is_local_publication(dds_data_reader, sample_infos[i])))
+    {
+      ++*conflated_count;
+    }
   }
 
-  if (!ignore_sample) {
-    cdr_stream->buffer_length = dds_messages[0].serialized_data.length();
+  if (index >= 0) {
+    cdr_stream->buffer_length = dds_messages[index].serialized_data.length();
     // TODO(karsten1987): This malloc has to go!
     cdr_stream->buffer =
       reinterpret_cast<uint8_t *>(malloc(cdr_stream->buffer_length * sizeof(uint8_t)));
@@ -116,7 +143,8 @@ take(
       *taken = false;
       return false;
     }
-    memcpy(cdr_stream->buffer, &dds_messages[0].serialized_data[0], cdr_stream->buffer_length);
+    memcpy(
+      cdr_stream->buffer, &dds_messages[index].serialized_data[0], cdr_stream->buffer_length);
 
     *taken = true;
   } else {
@@ -128,6 +156,52 @@ take(
   return status == DDS::RETCODE_OK;
 }
 
+static void
+fill_message_info(const DDS::SampleInfo & sample_info, rmw_message_info_t * message_info)
+{
+  rmw_gid_t * sender_gid = &message_info->publisher_gid;
+  sender_gid->implementation_identifier = rti_connext_identifier;
+  memset(sender_gid->data, 0, RMW_GID_STORAGE_SIZE);
+  auto detail = reinterpret_cast<ConnextPublisherGID *>(sender_gid->data);
+  detail->publication_handle = sample_info.publication_handle;
+}
+
+static rmw_time_t
+dds_time_to_rmw(const DDS::Time_t & time)
+{
+  rmw_time_t rmw_time;
+  rmw_time.sec = static_cast<uint64_t>(time.sec);
+  rmw_time.nsec = time.nanosec;
+  return rmw_time;
+}
+
+static void
+fill_message_timestamps(
+  const DDS::SampleInfo & sample_info, rmw_connext_cpp::MessageTimestamps * timestamps)
+{
+  timestamps->source_timestamp = dds_time_to_rmw(sample_info.source_timestamp);
+  timestamps->reception_timestamp = dds_time_to_rmw(sample_info.reception_timestamp);
+}
+
+static int64_t
+source_timestamp_ns(const DDS::SampleInfo & sample_info)
+{
+  return static_cast<int64_t>(sample_info.source_timestamp.sec) * 1000000000LL +
+         sample_info.source_timestamp.nanosec;
+}
+
+static void
+record_statistics(
+  ConnextStaticSubscriberInfo * subscriber_info, size_t bytes, const DDS::SampleInfo & sample_info)
+{
+  // the source timestamp comes from the clock of the publishing host
+  const int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::system_clock::now().time_since_epoch()).count();
+  const int64_t source_ns = source_timestamp_ns(sample_info);
+  subscriber_info->statistics_.record(
+    TopicStatistics::Clock::now(), bytes, now_ns >= source_ns ? now_ns - source_ns : 0);
+}
+
 extern "C"
 {
 rmw_ret_t
@@ -135,7 +209,7 @@ _take(
   const rmw_subscription_t * subscription,
   void * ros_message,
   bool * taken,
-  DDS::InstanceHandle_t * sending_publication_handle,
+  DDS::SampleInfo * sample_info,
   rmw_subscription_allocation_t * allocation)
 {
   if (!subscription) {
@@ -173,20 +247,47 @@ _take(
     return RMW_RET_ERROR;
   }
 
+  // the statistics and tracepoints need the source timestamp even if the caller doesn't want the
+  // sample info
+  DDS::SampleInfo local_sample_info;
+  if (!sample_info && (RMW_CONNEXT_TRACING_ENABLED || subscriber_info->statistics_enabled_)) {
+    sample_info = &local_sample_info;
+  }
+
   // fetch the incoming message as cdr stream
   rcutils_uint8_array_t cdr_stream = rcutils_get_zero_initialized_uint8_array();
+  size_t conflated_count = 0;
+  RMW_CONNEXT_TRACE_TIMESTAMP(take_start);
   if (!take(
-      topic_reader, subscription->options.ignore_local_publications, &cdr_stream, taken,
-      sending_publication_handle, allocation))
+      topic_reader, subscription->options.ignore_local_publications, subscriber_info->latest_only_,
+      &cdr_stream, taken, &conflated_count, sample_info, allocation))
   {
     RMW_SET_ERROR_MSG("error occured while taking message");
+    subscriber_info->traffic_counter_.record_error();
     return RMW_RET_ERROR;
   }
+  RMW_CONNEXT_TRACE_TIMESTAMP(take_end);
+  if (*taken) {
+    subscriber_info->sample_size_record_->record(cdr_stream.buffer_length);
+    subscriber_info->traffic_counter_.record(cdr_stream.buffer_length);
+    if (subscriber_info->statistics_enabled_) {
+      record_statistics(subscriber_info, cdr_stream.buffer_length, *sample_info);
+    }
+  }
+  if (conflated_count > 0) {
+    subscriber_info->conflated_count_.fetch_add(conflated_count, std::memory_order_relaxed);
+  }
   // convert the cdr stream to the message
+  RMW_CONNEXT_TRACE_TIMESTAMP(deserialize_start);
   if (*taken && !callbacks->to_message(&cdr_stream, ros_message)) {
     RMW_SET_ERROR_MSG("can't convert cdr stream to ros message");
     return RMW_RET_ERROR;
   }
+  RMW_CONNEXT_TRACE_TIMESTAMP(deserialize_end);
+  RMW_CONNEXT_TRACEPOINT(
+    take, subscription, ros_message, *taken, cdr_stream.buffer_length,
+    *taken ? source_timestamp_ns(*sample_info) : 0, take_end - take_start,
+    deserialize_end - deserialize_start);
 
   // the call to take allocates memory for the serialized message
   // we have to free this here again
@@ -217,18 +318,14 @@ rmw_take_with_info(
     RMW_SET_ERROR_MSG("message info is null");
     return RMW_RET_ERROR;
   }
-  DDS::InstanceHandle_t sending_publication_handle;
-  auto ret = _take(subscription, ros_message, taken, &sending_publication_handle, allocation);
+  DDS::SampleInfo sample_info;
+  auto ret = _take(subscription, ros_message, taken, &sample_info, allocation);
   if (ret != RMW_RET_OK) {
     // Error string is already set.
     return RMW_RET_ERROR;
   }
 
-  rmw_gid_t * sender_gid = &message_info->publisher_gid;
-  sender_gid->implementation_identifier = rti_connext_identifier;
-  memset(sender_gid->data, 0, RMW_GID_STORAGE_SIZE);
-  auto detail = reinterpret_cast<ConnextPublisherGID *>(sender_gid->data);
-  detail->publication_handle = sending_publication_handle;
+  fill_message_info(sample_info, message_info);
 
   return RMW_RET_OK;
 }
@@ -238,7 +335,7 @@ _take_serialized_message(
   const rmw_subscription_t * subscription,
   rmw_serialized_message_t * serialized_message,
   bool * taken,
-  DDS::InstanceHandle_t * sending_publication_handle,
+  DDS::SampleInfo * sample_info,
   rmw_subscription_allocation_t * allocation)
 {
   if (!subscription) {
@@ -276,14 +373,38 @@ _take_serialized_message(
     return RMW_RET_ERROR;
   }
 
+  // the statistics and tracepoints need the source timestamp even if the caller doesn't want the
+  // sample info
+  DDS::SampleInfo local_sample_info;
+  if (!sample_info && (RMW_CONNEXT_TRACING_ENABLED || subscriber_info->statistics_enabled_)) {
+    sample_info = &local_sample_info;
+  }
+
   // fetch the incoming message as cdr stream
+  size_t conflated_count = 0;
+  RMW_CONNEXT_TRACE_TIMESTAMP(take_start);
   if (!take(
-      topic_reader, subscription->options.ignore_local_publications, serialized_message, taken,
-      sending_publication_handle, allocation))
+      topic_reader, subscription->options.ignore_local_publications, subscriber_info->latest_only_,
+      serialized_message, taken, &conflated_count, sample_info, allocation))
   {
     RMW_SET_ERROR_MSG("error occured while taking message");
+    subscriber_info->traffic_counter_.record_error();
     return RMW_RET_ERROR;
   }
+  RMW_CONNEXT_TRACE_TIMESTAMP(take_end);
+  RMW_CONNEXT_TRACEPOINT(
+    take, subscription, serialized_message, *taken, serialized_message->buffer_length,
+    *taken ? source_timestamp_ns(*sample_info) : 0, take_end - take_start, 0);
+  if (*taken) {
+    subscriber_info->sample_size_record_->record(serialized_message->buffer_length);
+    subscriber_info->traffic_counter_.record(serialized_message->buffer_length);
+    if (subscriber_info->statistics_enabled_) {
+      record_statistics(subscriber_info, serialized_message->buffer_length, *sample_info);
+    }
+  }
+  if (conflated_count > 0) {
+    subscriber_info->conflated_count_.fetch_add(conflated_count, std::memory_order_relaxed);
+  }
 
   return RMW_RET_OK;
 }
@@ -310,20 +431,16 @@ rmw_take_serialized_message_with_info(
     RMW_SET_ERROR_MSG("message info is null");
     return RMW_RET_ERROR;
   }
-  DDS::InstanceHandle_t sending_publication_handle;
+  DDS::SampleInfo sample_info;
   auto ret = _take_serialized_message(
     subscription, serialized_message, taken,
-    &sending_publication_handle, allocation);
+    &sample_info, allocation);
   if (ret != RMW_RET_OK) {
     // Error string is already set.
     return RMW_RET_ERROR;
   }
 
-  rmw_gid_t * sender_gid = &message_info->publisher_gid;
-  sender_gid->implementation_identifier = rti_connext_identifier;
-  memset(sender_gid->data, 0, RMW_GID_STORAGE_SIZE);
-  auto detail = reinterpret_cast<ConnextPublisherGID *>(sender_gid->data);
-  detail->publication_handle = sending_publication_handle;
+  fill_message_info(sample_info, message_info);
 
   return RMW_RET_OK;
 }
@@ -375,3 +492,57 @@ rmw_return_loaned_message_from_subscription(
   return RMW_RET_UNSUPPORTED;
 }
 }  // extern "C"
+
+namespace rmw_connext_cpp
+{
+
+rmw_ret_t
+take_with_timestamps(
+  const rmw_subscription_t * subscription,
+  void * ros_message,
+  bool * taken,
+  rmw_message_info_t * message_info,
+  MessageTimestamps * timestamps,
+  rmw_subscription_allocation_t * allocation)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(message_info, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(timestamps, RMW_RET_INVALID_ARGUMENT);
+  DDS::SampleInfo sample_info;
+  auto ret = _take(subscription, ros_message, taken, &sample_info, allocation);
+  if (ret != RMW_RET_OK) {
+    // Error string is already set.
+    return RMW_RET_ERROR;
+  }
+  if (*taken) {
+    fill_message_info(sample_info, message_info);
+    fill_message_timestamps(sample_info, timestamps);
+  }
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+take_serialized_message_with_timestamps(
+  const rmw_subscription_t * subscription,
+  rmw_serialized_message_t * serialized_message,
+  bool * taken,
+  rmw_message_info_t * message_info,
+  MessageTimestamps * timestamps,
+  rmw_subscription_allocation_t * allocation)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(message_info, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(timestamps, RMW_RET_INVALID_ARGUMENT);
+  DDS::SampleInfo sample_info;
+  auto ret = _take_serialized_message(
+    subscription, serialized_message, taken, &sample_info, allocation);
+  if (ret != RMW_RET_OK) {
+    // Error string is already set.
+    return RMW_RET_ERROR;
+  }
+  if (*taken) {
+    fill_message_info(sample_info, message_info);
+    fill_message_timestamps(sample_info, timestamps);
+  }
+  return RMW_RET_OK;
+}
+
+}  // namespace rmw_connext_cpp
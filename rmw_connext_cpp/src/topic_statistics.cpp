@@ -0,0 +1,71 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/error_handling.h"
+#include "rmw/impl/cpp/macros.hpp"
+
+#include "rmw_connext_cpp/connext_static_publisher_info.hpp"
+#include "rmw_connext_cpp/connext_static_subscriber_info.hpp"
+#include "rmw_connext_cpp/identifier.hpp"
+#include "rmw_connext_cpp/topic_statistics.hpp"
+
+namespace rmw_connext_cpp
+{
+
+rmw_ret_t
+get_publisher_statistics(const rmw_publisher_t * publisher, TopicStatisticsSnapshot * snapshot)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(publisher, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(snapshot, RMW_RET_INVALID_ARGUMENT);
+  if (publisher->implementation_identifier != rti_connext_identifier) {
+    RMW_SET_ERROR_MSG("publisher handle is not from this rmw implementation");
+    return RMW_RET_ERROR;
+  }
+  auto info = static_cast<ConnextStaticPublisherInfo *>(publisher->data);
+  if (!info) {
+    RMW_SET_ERROR_MSG("publisher internal data is invalid");
+    return RMW_RET_ERROR;
+  }
+  if (!info->statistics_enabled_) {
+    RMW_SET_ERROR_MSG("statistics are not enabled for the topic of the publisher");
+    return RMW_RET_ERROR;
+  }
+  *snapshot = info->statistics_.get_snapshot(TopicStatistics::Clock::now());
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+get_subscription_statistics(
+  const rmw_subscription_t * subscription, TopicStatisticsSnapshot * snapshot)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(subscription, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(snapshot, RMW_RET_INVALID_ARGUMENT);
+  if (subscription->implementation_identifier != rti_connext_identifier) {
+    RMW_SET_ERROR_MSG("subscription handle is not from this rmw implementation");
+    return RMW_RET_ERROR;
+  }
+  auto info = static_cast<ConnextStaticSubscriberInfo *>(subscription->data);
+  if (!info) {
+    RMW_SET_ERROR_MSG("subscription internal data is invalid");
+    return RMW_RET_ERROR;
+  }
+  if (!info->statistics_enabled_) {
+    RMW_SET_ERROR_MSG("statistics are not enabled for the topic of the subscription");
+    return RMW_RET_ERROR;
+  }
+  *snapshot = info->statistics_.get_snapshot(TopicStatistics::Clock::now());
+  return RMW_RET_OK;
+}
+
+}  // namespace rmw_connext_cpp
@@ -0,0 +1,103 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_SHARED_CPP__CONNEXT_EVENT_TYPES_HPP_
+#define RMW_CONNEXT_SHARED_CPP__CONNEXT_EVENT_TYPES_HPP_
+
+#include <cstdint>
+
+#include "rmw/event.h"
+
+/**
+ * Connext specific subscription events, numbered after the last rmw_event_type_t.
+ *
+ * Pass them to rmw_subscription_event_init(), wait on the event with rmw_wait() and take it
+ * with rmw_take_event(), which fills the status struct documented next to each event type.
+ */
+
+/// Values of the Connext specific event types.
+enum rmw_connext_event_type_t
+{
+  RMW_CONNEXT_EVENT_TYPE_SAMPLE_LOST = RMW_EVENT_INVALID + 1,
+  RMW_CONNEXT_EVENT_TYPE_SAMPLE_REJECTED,
+  RMW_CONNEXT_EVENT_TYPE_REQUESTED_INCOMPATIBLE_QOS,
+  RMW_CONNEXT_EVENT_TYPE_LAST = RMW_CONNEXT_EVENT_TYPE_REQUESTED_INCOMPATIBLE_QOS
+};
+
+/// Largest value of an unscoped enum without a fixed underlying type and no negative enumerator.
+/**
+ * \param largest_enumerator value of the largest enumerator of the enum
+ * \return the smallest power of two minus one which isn't less than the largest enumerator
+ */
+constexpr int
+rmw_connext_enum_value_max(int largest_enumerator)
+{
+  return largest_enumerator <= 1 ? 1 : 2 * rmw_connext_enum_value_max(largest_enumerator / 2) + 1;
+}
+
+// RMW_EVENT_INVALID is the largest enumerator of rmw_event_type_t, converting a larger value
+// which the enum can't hold would be undefined behavior.
+static_assert(
+  RMW_CONNEXT_EVENT_TYPE_LAST <= rmw_connext_enum_value_max(RMW_EVENT_INVALID),
+  "Connext specific event types don't fit in the values of rmw_event_type_t");
+
+/// Convert a Connext specific event type to the type taken by the rmw event functions.
+constexpr rmw_event_type_t
+to_rmw_event_type(rmw_connext_event_type_t event_type)
+{
+  return static_cast<rmw_event_type_t>(event_type);
+}
+
+/// Samples which were sent but never received, fills a rmw_connext_sample_lost_status_t.
+constexpr rmw_event_type_t RMW_CONNEXT_EVENT_SAMPLE_LOST =
+  to_rmw_event_type(RMW_CONNEXT_EVENT_TYPE_SAMPLE_LOST);
+
+/// Received samples the reader had no room for, fills a rmw_connext_sample_rejected_status_t.
+constexpr rmw_event_type_t RMW_CONNEXT_EVENT_SAMPLE_REJECTED =
+  to_rmw_event_type(RMW_CONNEXT_EVENT_TYPE_SAMPLE_REJECTED);
+
+/// Publications not matched because of their qos, fills a
+/// rmw_connext_requested_incompatible_qos_status_t.
+constexpr rmw_event_type_t RMW_CONNEXT_EVENT_REQUESTED_INCOMPATIBLE_QOS =
+  to_rmw_event_type(RMW_CONNEXT_EVENT_TYPE_REQUESTED_INCOMPATIBLE_QOS);
+
+typedef struct rmw_connext_sample_lost_status_t
+{
+  /// Number of samples lost since the subscription was created.
+  int32_t total_count;
+  /// Number of samples lost since the event was last taken.
+  int32_t total_count_change;
+} rmw_connext_sample_lost_status_t;
+
+typedef struct rmw_connext_sample_rejected_status_t
+{
+  /// Number of samples rejected since the subscription was created.
+  int32_t total_count;
+  /// Number of samples rejected since the event was last taken.
+  int32_t total_count_change;
+  /// Name of the resource limit which rejected the last sample, e.g. "max_samples".
+  const char * last_reason;
+} rmw_connext_sample_rejected_status_t;
+
+typedef struct rmw_connext_requested_incompatible_qos_status_t
+{
+  /// Number of incompatible publications since the subscription was created.
+  int32_t total_count;
+  /// Number of incompatible publications since the event was last taken.
+  int32_t total_count_change;
+  /// Name of the policy found incompatible last, e.g. "reliability".
+  const char * last_policy_name;
+} rmw_connext_requested_incompatible_qos_status_t;
+
+#endif  // RMW_CONNEXT_SHARED_CPP__CONNEXT_EVENT_TYPES_HPP_
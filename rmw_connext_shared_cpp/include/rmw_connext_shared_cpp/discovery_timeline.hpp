@@ -0,0 +1,85 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_SHARED_CPP__DISCOVERY_TIMELINE_HPP_
+#define RMW_CONNEXT_SHARED_CPP__DISCOVERY_TIMELINE_HPP_
+
+#include "rmw_connext_shared_cpp/ndds_include.hpp"
+#include "rmw_connext_shared_cpp/visibility_control.h"
+
+/**
+ * Environment variable enabling the discovery timeline.
+ *
+ * When set, the timeline is written at process exit to `<value><pid>.csv`, one event per line:
+ * `time_ns,event,guid,name` with the system time in nanoseconds since the epoch.
+ */
+#define RMW_CONNEXT_DISCOVERY_TIMELINE_ENV_VAR "RMW_CONNEXT_DISCOVERY_TIMELINE"
+
+/**
+ * Kind of event recorded in the discovery timeline.
+ */
+enum class DiscoveryEvent
+{
+  /// A participant was created for a node, the name is the node name.
+  ParticipantCreated,
+  /// A local data writer was created, the name is the topic name.
+  LocalPublisherCreated,
+  /// A local data reader was created, the name is the topic name.
+  LocalSubscriberCreated,
+  /// A data writer was announced on the builtin publication topic.
+  PublisherDiscovered,
+  /// A data writer was disposed on the builtin publication topic.
+  PublisherRemoved,
+  /// A data reader was announced on the builtin subscription topic.
+  SubscriberDiscovered,
+  /// A data reader was disposed on the builtin subscription topic.
+  SubscriberRemoved,
+  /// A local data writer matched its first data reader.
+  PublisherFirstMatched,
+  /// A local data reader matched its first data writer.
+  SubscriberFirstMatched
+};
+
+/// Check if the discovery timeline is recorded.
+/**
+ * \return true if RMW_CONNEXT_DISCOVERY_TIMELINE is set
+ */
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+bool
+discovery_timeline_enabled();
+
+/// Timestamp an event in the discovery timeline, if it is enabled.
+/**
+ * When the timeline is disabled this only costs a check of a flag.
+ *
+ * \param event kind of the event
+ * \param guid of the participant or endpoint concerned
+ * \param name of the node or topic concerned, may be null
+ */
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+void
+record_discovery_event(DiscoveryEvent event, const DDS::GUID_t & guid, const char * name);
+
+/// Timestamp an event in the discovery timeline, if it is enabled.
+/**
+ * \param event kind of the event
+ * \param instance_handle of the participant or endpoint concerned
+ * \param name of the node or topic concerned, may be null
+ */
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+void
+record_discovery_event(
+  DiscoveryEvent event, const DDS::InstanceHandle_t & instance_handle, const char * name);
+
+#endif  // RMW_CONNEXT_SHARED_CPP__DISCOVERY_TIMELINE_HPP_
@@ -41,6 +41,22 @@ DDS::StatusKind get_status_kind_from_rmw(rmw_event_type_t event_t);
 RMW_CONNEXT_SHARED_CPP_PUBLIC
 bool is_event_supported(rmw_event_type_t event_t);
 
+/// Return the name of the resource limit a sample was rejected by.
+/**
+ * \param reason of the last rejection in a SampleRejectedStatus
+ * \return a static string naming the limit
+ */
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+const char * get_sample_rejected_reason_name(DDS::SampleRejectedStatusKind reason);
+
+/// Return the name of a qos policy, as used in rmw_qos_profile_t where it exists.
+/**
+ * \param policy_id of the policy
+ * \return a static string naming the policy
+ */
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+const char * get_qos_policy_name(DDS::QosPolicyId_t policy_id);
+
 /// Assign the input DDS return code to its corresponding RMW return code.
 /**
   * \param dds_return_code input DDS return code
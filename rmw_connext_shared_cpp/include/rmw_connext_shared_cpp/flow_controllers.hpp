@@ -0,0 +1,81 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_SHARED_CPP__FLOW_CONTROLLERS_HPP_
+#define RMW_CONNEXT_SHARED_CPP__FLOW_CONTROLLERS_HPP_
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "rmw_connext_shared_cpp/visibility_control.h"
+
+/**
+ * Environment variable defining token bucket flow controllers created with each participant.
+ *
+ * The value is a ';' separated list of
+ * `<name>:<bytes per period>:<period in milliseconds>[:<max burst bytes>]`,
+ * asynchronous data writers select a flow controller by its name.
+ */
+#define RMW_CONNEXT_FLOW_CONTROLLERS_ENV_VAR "RMW_CONNEXT_FLOW_CONTROLLERS"
+
+/// Number of bytes each token of a flow controller allows to send.
+#define RMW_CONNEXT_FLOW_CONTROLLER_BYTES_PER_TOKEN 1024
+
+/// Token bucket flow controller shaping the traffic of the data writers using it.
+struct FlowControllerConfig
+{
+  std::string name;
+  /// Number of bytes which may be sent per period.
+  size_t bytes_per_period;
+  /// Length of a period in milliseconds.
+  size_t period_ms;
+  /// Number of bytes which may be sent at once after idle periods.
+  size_t max_burst_bytes;
+};
+
+/// Parse the flow controllers defined by RMW_CONNEXT_FLOW_CONTROLLERS_ENV_VAR.
+/**
+ * \param value the value of the environment variable
+ * \param flow_controllers the parsed flow controllers
+ * \return true if successful, false if the value is malformed
+ */
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+bool
+parse_flow_controllers(
+  const std::string & value,
+  std::vector<FlowControllerConfig> & flow_controllers);
+
+/// Check if a value of RMW_CONNEXT_FLOW_CONTROLLERS_ENV_VAR defines a flow controller.
+/**
+ * \param value the value of the environment variable
+ * \param name name of the flow controller
+ * \return true if the value is well formed and defines a flow controller with this name
+ */
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+bool
+is_flow_controller_defined(const std::string & value, const std::string & name);
+
+/// Get the participant properties which create a flow controller.
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+std::vector<std::pair<std::string, std::string>>
+get_flow_controller_properties(const FlowControllerConfig & flow_controller);
+
+/// Get the name a data writer uses to select a flow controller.
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+std::string
+get_flow_controller_name(const std::string & name);
+
+#endif  // RMW_CONNEXT_SHARED_CPP__FLOW_CONTROLLERS_HPP_
@@ -0,0 +1,72 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_SHARED_CPP__GRAPH_CHANGES_HPP_
+#define RMW_CONNEXT_SHARED_CPP__GRAPH_CHANGES_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include "rmw/types.h"
+
+#include "rmw_connext_shared_cpp/types.hpp"
+#include "rmw_connext_shared_cpp/visibility_control.h"
+
+/**
+ * Discovery delta for a single remote or local endpoint.
+ */
+struct ConnextGraphChange
+{
+  EntityType entity_type;
+  DDSTopicChange change;
+};
+
+/**
+ * Position of a consumer in the publisher and subscriber change logs of a node.
+ *
+ * A zero-initialized cursor requests every change still held in the change logs.
+ */
+struct ConnextGraphChangeCursor
+{
+  uint64_t publisher_sequence;
+  uint64_t subscriber_sequence;
+};
+
+/// Get the graph changes recorded since the given cursor.
+/**
+ * Publisher changes are appended first, followed by subscriber changes, each in sequence
+ * order.
+ * The cursor is advanced past the returned changes.
+ * When `complete` is false some changes were dropped from the bounded change logs and the
+ * caller has to rebuild its view of the graph, e.g. with `rmw_get_topic_names_and_types`.
+ *
+ * \param implementation_identifier of the calling rmw implementation
+ * \param node to query
+ * \param cursor [in/out] last sequence numbers already seen by the caller
+ * \param changes [out] changes recorded after the cursor
+ * \param complete [out] true if no change after the cursor was dropped
+ * \return RMW_RET_OK if successful, or
+ * \return RMW_RET_INVALID_ARGUMENT if an argument is null, or
+ * \return RMW_RET_ERROR if the node is not from this implementation
+ */
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+rmw_ret_t
+get_graph_changes(
+  const char * implementation_identifier,
+  const rmw_node_t * node,
+  ConnextGraphChangeCursor * cursor,
+  std::vector<ConnextGraphChange> * changes,
+  bool * complete);
+
+#endif  // RMW_CONNEXT_SHARED_CPP__GRAPH_CHANGES_HPP_
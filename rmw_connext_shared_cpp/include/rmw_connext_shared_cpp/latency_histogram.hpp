@@ -0,0 +1,102 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_SHARED_CPP__LATENCY_HISTOGRAM_HPP_
+#define RMW_CONNEXT_SHARED_CPP__LATENCY_HISTOGRAM_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "rmw_connext_shared_cpp/visibility_control.h"
+
+/**
+ * Distribution of latencies in nanoseconds, with a relative precision of 1/8.
+ *
+ * Latencies are counted in buckets growing exponentially with 8 linear sub-buckets each, so
+ * recording is lock free and the memory used doesn't depend on the number of samples.
+ * Meant to be fed with the difference between the reception and source timestamps of the taken
+ * samples, negative differences caused by clock skew between hosts are counted as 0.
+ */
+class LatencyHistogram
+{
+public:
+  /// Number of linear sub-buckets per power of two.
+  static constexpr size_t sub_buckets = 8;
+  /// Number of buckets needed to cover every positive 64 bit latency.
+  static constexpr size_t bucket_count = sub_buckets + (63 - 3) * sub_buckets;
+
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  LatencyHistogram();
+
+  /// Record a latency, can be called concurrently with every other method.
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  void
+  record(int64_t latency_ns);
+
+  /// Get the number of recorded latencies.
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  uint64_t
+  get_count() const;
+
+  /// Get the number of recorded latencies which were negative.
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  uint64_t
+  get_negative_count() const;
+
+  /// Get the smallest recorded latency, 0 if nothing was recorded.
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  int64_t
+  get_min() const;
+
+  /// Get the largest recorded latency, 0 if nothing was recorded.
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  int64_t
+  get_max() const;
+
+  /// Get an upper bound of a percentile of the recorded latencies.
+  /**
+   * \param percentile between 0 and 100
+   * \return the upper bound of the bucket holding the percentile, at most the largest recorded
+   *   latency, or 0 if nothing was recorded
+   */
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  int64_t
+  get_percentile(double percentile) const;
+
+  /// Forget every recorded latency.
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  void
+  reset();
+
+  /// Get the index of the bucket counting a latency.
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  static size_t
+  get_bucket_index(int64_t latency_ns);
+
+  /// Get the largest latency counted by a bucket.
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  static int64_t
+  get_bucket_upper_bound(size_t index);
+
+private:
+  std::array<std::atomic<uint64_t>, bucket_count> buckets_;
+  std::atomic<uint64_t> count_;
+  std::atomic<uint64_t> negative_count_;
+  std::atomic<int64_t> min_;
+  std::atomic<int64_t> max_;
+};
+
+#endif  // RMW_CONNEXT_SHARED_CPP__LATENCY_HISTOGRAM_HPP_
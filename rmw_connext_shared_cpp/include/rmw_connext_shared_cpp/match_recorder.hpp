@@ -0,0 +1,97 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_SHARED_CPP__MATCH_RECORDER_HPP_
+#define RMW_CONNEXT_SHARED_CPP__MATCH_RECORDER_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "rmw/types.h"
+
+#include "rmw_connext_shared_cpp/ndds_include.hpp"
+#include "rmw_connext_shared_cpp/visibility_control.h"
+
+/// A peer matching or unmatching a publisher or subscription.
+struct MatchEvent
+{
+  /// Time elapsed between the creation of the endpoint and this event.
+  std::chrono::nanoseconds time_since_creation;
+  /// True if the peer matched, false if it unmatched.
+  bool matched;
+  /// GID of the peer data reader or data writer.
+  rmw_gid_t peer_gid;
+  /// Number of matched peers after this event.
+  size_t current_count;
+};
+
+/// Matching history of a publisher or subscription.
+struct MatchMetrics
+{
+  /// True once the endpoint matched its first peer.
+  bool has_matched;
+  /// Time elapsed between the creation of the endpoint and its first match.
+  std::chrono::nanoseconds time_to_first_match;
+  /// Most recent match and unmatch events, oldest first.
+  std::vector<MatchEvent> history;
+};
+
+/// Records the match events of a publisher or subscription, from its creation on.
+class MatchRecorder
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /// Maximum number of events kept in the history, older ones are dropped.
+  static constexpr size_t max_history = 1024;
+
+  /**
+   * \param implementation_identifier identifier set in the gids of the peers
+   * \param creation_time time the endpoint was created
+   */
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  explicit MatchRecorder(
+    const char * implementation_identifier, Clock::time_point creation_time = Clock::now());
+
+  /// Record a change of the matched peers.
+  /**
+   * \param matched true if the peer matched, false if it unmatched
+   * \param peer_handle instance handle of the peer
+   * \param current_count number of matched peers after the change
+   * \param now time of the change
+   * \return true if this is the first match of the endpoint
+   */
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  bool
+  record(
+    bool matched, const DDS::InstanceHandle_t & peer_handle, size_t current_count,
+    Clock::time_point now = Clock::now());
+
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  void
+  get_metrics(MatchMetrics & metrics) const;
+
+private:
+  const char * implementation_identifier_;
+  const Clock::time_point creation_time_;
+  mutable std::mutex mutex_;
+  bool has_matched_;
+  std::chrono::nanoseconds time_to_first_match_;
+  std::deque<MatchEvent> history_;
+};
+
+#endif  // RMW_CONNEXT_SHARED_CPP__MATCH_RECORDER_HPP_
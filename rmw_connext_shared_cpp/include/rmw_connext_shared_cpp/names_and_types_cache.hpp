@@ -0,0 +1,86 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_SHARED_CPP__NAMES_AND_TYPES_CACHE_HPP_
+#define RMW_CONNEXT_SHARED_CPP__NAMES_AND_TYPES_CACHE_HPP_
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+
+#include "rmw_connext_shared_cpp/visibility_control.h"
+
+/**
+ * Kind of names and types memoized by NamesAndTypesCache.
+ */
+enum NamesAndTypesKind
+{
+  /// Topic names and types, demangled and restricted to ROS topics.
+  DemangledTopics,
+  /// Topic names and types as seen on the wire.
+  RawTopics,
+  /// Service names and types.
+  Services,
+  NamesAndTypesKindCount
+};
+
+/**
+ * Last names and types computed for a node, reused while the discovery caches are unchanged.
+ *
+ * Each entry is tagged with the generation of the publisher and subscriber topic caches it
+ * was computed from, and is only recomputed once either of them moved.
+ */
+class NamesAndTypesCache
+{
+public:
+  using NamesAndTypes = std::map<std::string, std::set<std::string>>;
+  using FillFunction = std::function<void (NamesAndTypes &)>;
+
+  /// Get the memoized names and types of a kind, computing them if they are out of date.
+  /**
+   * The generations have to be read before `fill` looks at the topic caches, so that a change
+   * racing with `fill` only causes a spurious recomputation on the next call.
+   *
+   * \param kind of names and types to get
+   * \param publisher_generation current generation of the publisher topic cache
+   * \param subscriber_generation current generation of the subscriber topic cache
+   * \param fill function filling a fresh map when the memoized one is out of date
+   * \return the memoized names and types, never null
+   */
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  std::shared_ptr<const NamesAndTypes>
+  get(
+    NamesAndTypesKind kind,
+    uint64_t publisher_generation,
+    uint64_t subscriber_generation,
+    const FillFunction & fill);
+
+private:
+  struct Entry
+  {
+    uint64_t publisher_generation = 0;
+    uint64_t subscriber_generation = 0;
+    std::shared_ptr<const NamesAndTypes> names_and_types;
+  };
+
+  std::mutex mutex_;
+  std::array<Entry, NamesAndTypesKindCount> entries_;
+};
+
+#endif  // RMW_CONNEXT_SHARED_CPP__NAMES_AND_TYPES_CACHE_HPP_
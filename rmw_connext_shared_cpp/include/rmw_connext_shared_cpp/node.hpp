@@ -19,6 +19,16 @@
 
 #include "rmw_connext_shared_cpp/visibility_control.h"
 
+/**
+ * Environment variable selecting the transport used by localhost only nodes.
+ *
+ * - `udp` (default): UDPv4 restricted to the loopback interface, with loopback traffic forced
+ *   so that other DDS implementations on the same host can communicate.
+ * - `shmem`: only the builtin shared memory transport, which avoids sending every local sample
+ *   over both shared memory and loopback, but only reaches Connext participants.
+ */
+#define RMW_CONNEXT_LOCALHOST_TRANSPORT_ENV_VAR "RMW_CONNEXT_LOCALHOST_TRANSPORT"
+
 RMW_CONNEXT_SHARED_CPP_PUBLIC
 rmw_node_t *
 create_node(
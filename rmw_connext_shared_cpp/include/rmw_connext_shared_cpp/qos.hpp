@@ -16,6 +16,7 @@
 #define RMW_CONNEXT_SHARED_CPP__QOS_HPP_
 
 #include <cassert>
+#include <cstddef>
 #include <limits>
 
 #include "ndds_include.hpp"
@@ -25,11 +26,70 @@
 
 #include "rmw_connext_shared_cpp/visibility_control.h"
 
+/**
+ * Environment variable naming QoS profile library files, separated by ';'.
+ *
+ * The files are parsed once by load_qos_settings() and cached by the participant factory.
+ */
+#define RMW_CONNEXT_QOS_PROFILE_FILES_ENV_VAR "RMW_CONNEXT_QOS_PROFILE_FILES"
+
+/**
+ * Environment variable selecting the profile used for data readers and writers,
+ * as `<library>::<profile>`.
+ *
+ * The QoS of each data reader and writer is taken from the profile, using the `topic_filter`
+ * patterns of the profile to select the QoS by DDS topic name (e.g. `rt/camera/*`).
+ * Policies which are not set to their system default in the rmw QoS profile still override
+ * the values from the XML profile.
+ * Data writers always publish asynchronously, only the `flow_controller_name` of the
+ * `publish_mode` of the profile is used.
+ */
+#define RMW_CONNEXT_QOS_PROFILE_ENV_VAR "RMW_CONNEXT_QOS_PROFILE"
+
+/**
+ * Environment variable enabling preallocated resource limits when set to "1".
+ *
+ * The sample pools of keep last data readers and writers are then allocated up front for the
+ * full history depth, instead of growing while the first samples arrive.
+ */
+#define RMW_CONNEXT_PREALLOCATE_SAMPLES_ENV_VAR "RMW_CONNEXT_PREALLOCATE_SAMPLES"
+
+/**
+ * Environment variable enabling a bounded reassembly pool for fragmented samples when set to "1".
+ *
+ * Keep last data readers of types with a bounded serialized size then reassemble at most
+ * depth fragmented samples at a time, into pool buffers fitting their largest sample.
+ * Data readers of unbounded types are not affected.
+ */
+#define RMW_CONNEXT_BOUNDED_FRAGMENTED_SAMPLES_ENV_VAR "RMW_CONNEXT_BOUNDED_FRAGMENTED_SAMPLES"
+
+/**
+ * Time a sample waits at most in an incomplete batch when batching is enabled without a flush
+ * delay.
+ *
+ * The rmw never flushes data writers explicitly, so without it a batch which doesn't fill up
+ * would never be sent.
+ */
+#define RMW_CONNEXT_BATCH_DEFAULT_MAX_FLUSH_DELAY_MS 10
+
+/// Load the QoS settings and profile libraries named in the environment.
+/**
+ * Only the first successful call has an effect.
+ *
+ * \return true if successful or if nothing is configured
+ */
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+bool
+load_qos_settings();
+
 RMW_CONNEXT_SHARED_CPP_PUBLIC
 bool
 get_datareader_qos(
   DDS::DomainParticipant * participant,
   const rmw_qos_profile_t & qos_profile,
+  const char * topic_name,
+  size_t pool_buffer_max_size,
+  size_t max_serialized_size,
   DDS::DataReaderQos & datareader_qos);
 
 RMW_CONNEXT_SHARED_CPP_PUBLIC
@@ -37,8 +97,55 @@ bool
 get_datawriter_qos(
   DDS::DomainParticipant * participant,
   const rmw_qos_profile_t & qos_profile,
+  const char * topic_name,
+  size_t pool_buffer_max_size,
   DDS::DataWriterQos & datawriter_qos);
 
+/// Send the samples of an asynchronous data writer through a flow controller.
+/**
+ * \param flow_controller_name name of a flow controller defined in
+ *   RMW_CONNEXT_FLOW_CONTROLLERS_ENV_VAR
+ * \param datawriter_qos the data writer qos to update
+ * \return true if successful, false if the flow controller isn't defined
+ */
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+bool
+set_flow_controller_qos(
+  const char * flow_controller_name,
+  DDS::DataWriterQos & datawriter_qos);
+
+/// Enable writer side batching.
+/**
+ * \param max_samples maximum number of samples in a batch, 0 for no limit
+ * \param max_data_bytes maximum number of serialized bytes in a batch, 0 to keep the Connext
+ *   default
+ * \param max_flush_delay maximum time a sample waits in an incomplete batch, 0 for
+ *   RMW_CONNEXT_BATCH_DEFAULT_MAX_FLUSH_DELAY_MS
+ * \param batch the batch policy to update
+ * \return true if successful, false if a limit exceeds the DDS type
+ */
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+bool
+set_batch_qos(
+  size_t max_samples,
+  size_t max_data_bytes,
+  const rmw_time_t & max_flush_delay,
+  DDS::BatchQosPolicy & batch);
+
+/// Drop the samples which arrive sooner than a minimum separation after the previous one.
+/**
+ * Data writers apply the filter before sending, so the samples are not sent at all.
+ *
+ * \param minimum_separation minimum time between two samples of an instance, 0 for no filter
+ * \param datareader_qos the data reader qos to update
+ * \return true if successful, false if the separation is longer than the deadline period
+ */
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+bool
+set_time_based_filter_qos(
+  const rmw_time_t & minimum_separation,
+  DDS::DataReaderQos & datareader_qos);
+
 template<typename AttributeT>
 void
 dds_qos_to_rmw_qos(
@@ -0,0 +1,52 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_SHARED_CPP__RESOURCE_LIMITS_HPP_
+#define RMW_CONNEXT_SHARED_CPP__RESOURCE_LIMITS_HPP_
+
+#include "rmw_connext_shared_cpp/ndds_include.hpp"
+#include "rmw_connext_shared_cpp/visibility_control.h"
+
+/// Set resource limits which allocate all samples of a history when the entity is created.
+/**
+ * ROS topics are keyless, so the single instance holds up to `depth` samples and the
+ * initial number of samples is raised to the maximum.
+ * Together with the fast_pool buffer size this allocates all sample memory up front.
+ *
+ * \param history the history policy of the data reader or writer
+ * \param resource_limits the resource limits to update
+ * \return true if the limits were set, false for histories which are not bounded
+ */
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+bool
+set_preallocated_resource_limits(
+  const DDS::HistoryQosPolicy & history,
+  DDS::ResourceLimitsQosPolicy & resource_limits);
+
+/// Bound the number of fragmented samples a data reader reassembles at the same time.
+/**
+ * The reassembly resources are sized from the history depth and allocated when the data
+ * reader is created, so large samples do not grow them while they arrive.
+ *
+ * \param history the history policy of the data reader
+ * \param reader_resource_limits the reader resource limits to update
+ * \return true if the limits were set, false for histories which are not bounded
+ */
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+bool
+set_bounded_fragmented_samples(
+  const DDS::HistoryQosPolicy & history,
+  DDS::DataReaderResourceLimitsQosPolicy & reader_resource_limits);
+
+#endif  // RMW_CONNEXT_SHARED_CPP__RESOURCE_LIMITS_HPP_
@@ -0,0 +1,93 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_SHARED_CPP__SAMPLE_SIZE_HPP_
+#define RMW_CONNEXT_SHARED_CPP__SAMPLE_SIZE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+#include "rmw_connext_shared_cpp/ndds_include.hpp"
+#include "rmw_connext_shared_cpp/visibility_control.h"
+
+/// Pool buffer size used when nothing is known about the size of the samples.
+#define RMW_CONNEXT_DEFAULT_POOL_BUFFER_MAX_SIZE 4096
+
+/// Largest pool buffer size, bigger samples are allocated dynamically by Connext.
+#define RMW_CONNEXT_MAX_POOL_BUFFER_MAX_SIZE 65536
+
+/// Overhead of wrapping a CDR stream into a ConnextStaticSerializedData sample.
+#define RMW_CONNEXT_SERIALIZED_DATA_OVERHEAD 8
+
+/**
+ * Largest serialized size of the samples of a type seen by this process.
+ *
+ * Updated from the publish and take paths, it is used to size the sample pools of endpoints
+ * created later for types without a bound on their serialized size.
+ */
+class SampleSizeRecord
+{
+public:
+  /// Record the serialized size of a sample.
+  void record(size_t size)
+  {
+    size_t max_size = max_size_.load(std::memory_order_relaxed);
+    while (size > max_size &&
+      !max_size_.compare_exchange_weak(max_size, size, std::memory_order_relaxed))
+    {
+    }
+  }
+
+  /// Get the largest recorded size, 0 if no sample has been recorded.
+  size_t get() const
+  {
+    return max_size_.load(std::memory_order_relaxed);
+  }
+
+private:
+  std::atomic<size_t> max_size_{0};
+};
+
+/// Get the sample size record of a type, the record lives until the process exits.
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+SampleSizeRecord *
+get_sample_size_record(const std::string & type_name);
+
+/// Compute the maximum serialized size of the samples of a type.
+/**
+ * The size includes the encapsulation header and the worst case CDR alignment.
+ *
+ * \param type_code type code of the type
+ * \return the maximum serialized size, or 0 if the serialized size is unbounded
+ */
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+size_t
+get_max_serialized_size(const DDS::TypeCode * type_code);
+
+/// Choose the fast_pool buffer size for the samples of an endpoint.
+/**
+ * Bounded types get a buffer fitting their largest sample, unbounded types a buffer fitting
+ * the largest sample observed so far rounded up to a power of two.
+ * The result is clamped to RMW_CONNEXT_MAX_POOL_BUFFER_MAX_SIZE.
+ *
+ * \param max_serialized_size result of get_max_serialized_size(), 0 if unbounded
+ * \param observed_size largest observed serialized size, 0 if unknown
+ * \return the pool buffer size
+ */
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+size_t
+get_pool_buffer_max_size(size_t max_serialized_size, size_t observed_size);
+
+#endif  // RMW_CONNEXT_SHARED_CPP__SAMPLE_SIZE_HPP_
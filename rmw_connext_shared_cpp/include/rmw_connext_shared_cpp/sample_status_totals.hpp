@@ -0,0 +1,75 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_SHARED_CPP__SAMPLE_STATUS_TOTALS_HPP_
+#define RMW_CONNEXT_SHARED_CPP__SAMPLE_STATUS_TOTALS_HPP_
+
+#include <cstdint>
+#include <mutex>
+
+#include "rmw_connext_shared_cpp/ndds_include.hpp"
+#include "rmw_connext_shared_cpp/visibility_control.h"
+
+/// Totals of the sample lost and sample rejected statuses of a data reader.
+/**
+ * Reading a DDS status clears its changed bit, which is what wakes up a wait on the status
+ * event. The totals therefore only read a status themselves while no event was attached to it,
+ * afterwards they are fed by the event reading the status.
+ */
+class SampleStatusTotals
+{
+public:
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  SampleStatusTotals();
+
+  /// Leave a status to the event attached to it, other status kinds are ignored.
+  /**
+   * \param status_kind DDS_SAMPLE_LOST_STATUS or DDS_SAMPLE_REJECTED_STATUS
+   */
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  void
+  attach_event(DDS::StatusKind status_kind);
+
+  /// Read the sample lost status for its event and update the total.
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  DDS::ReturnCode_t
+  read_status(DDS::DataReader * reader, DDS::SampleLostStatus & status);
+
+  /// Read the sample rejected status for its event and update the total.
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  DDS::ReturnCode_t
+  read_status(DDS::DataReader * reader, DDS::SampleRejectedStatus & status);
+
+  /// Get the totals, reading the statuses which no event is attached to.
+  /**
+   * The total of a status with an attached event is the one the event last read.
+   *
+   * \param reader the data reader of the statuses
+   * \param samples_lost [out] number of samples sent but never received
+   * \param samples_rejected [out] number of received samples the reader had no room for
+   * \return DDS::RETCODE_OK if successful, or the error of reading a status
+   */
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  DDS::ReturnCode_t
+  get_totals(DDS::DataReader * reader, uint64_t & samples_lost, uint64_t & samples_rejected);
+
+private:
+  std::mutex mutex_;
+  bool sample_lost_event_attached_;
+  bool sample_rejected_event_attached_;
+  DDS::Long samples_lost_;
+  DDS::Long samples_rejected_;
+};
+
+#endif  // RMW_CONNEXT_SHARED_CPP__SAMPLE_STATUS_TOTALS_HPP_
@@ -16,6 +16,8 @@
 #define RMW_CONNEXT_SHARED_CPP__TOPIC_CACHE_HPP_
 
 #include <algorithm>
+#include <cstdint>
+#include <deque>
 #include <iterator>
 #include <map>
 #include <mutex>
@@ -23,6 +25,7 @@
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "rcutils/logging_macros.h"
 
@@ -53,8 +56,45 @@ public:
     rmw_qos_profile_t qos_profile;
   };
 
+  /**
+   * Kind of change recorded in the discovery change log.
+   */
+  enum class TopicChangeKind
+  {
+    EndpointAdded,
+    EndpointRemoved
+  };
+
+  /**
+   * A single discovery delta, numbered by a monotonic sequence number.
+   */
+  struct TopicChange
+  {
+    uint64_t sequence;
+    TopicChangeKind kind;
+    TopicInfo info;
+  };
+
   using ParticipantToTopicEndpointGuids = std::map<GUID_t, std::multiset<GUID_t>>;
   using TopicEndpointGuidToInfo = std::map<GUID_t, TopicInfo>;
+  using TopicNameToTopicEndpointGuids = std::map<std::string, std::set<GUID_t>>;
+
+  /**
+   * Topics and types used by a participant, kept up to date on every add and remove.
+   */
+  struct ParticipantTopicsTypes
+  {
+    TopicsTypes topics_types;
+    /// Number of endpoints using each (topic name, type name) pair.
+    std::map<std::pair<std::string, std::string>, size_t> endpoint_counts;
+  };
+
+  using ParticipantToTopicsTypes = std::map<GUID_t, ParticipantTopicsTypes>;
+
+  /**
+   * Default number of changes kept in the change log.
+   */
+  static constexpr size_t default_max_recorded_changes = 4096;
 
   /**
    * \return a map of topic name to the vector of topic types used.
@@ -72,6 +112,69 @@ public:
     return participant_to_endpoint_guids_;
   }
 
+  /**
+   * Get the endpoints using a topic.
+   *
+   * \param topic_name of the endpoints, as seen on the wire
+   * \return endpoint guids using that topic, valid until the cache is modified
+   */
+  const std::set<GUID_t> & get_topic_endpoint_guids(const std::string & topic_name) const
+  {
+    static const std::set<GUID_t> empty_endpoint_guids;
+    const auto endpoint_guids = topic_name_to_endpoint_guids_.find(topic_name);
+    if (endpoint_guids == topic_name_to_endpoint_guids_.end()) {
+      return empty_endpoint_guids;
+    }
+    return endpoint_guids->second;
+  }
+
+  /**
+   * \return the sequence number of the most recently recorded change, 0 if none.
+   */
+  uint64_t get_sequence() const
+  {
+    return sequence_;
+  }
+
+  /**
+   * Set how many changes are kept in the change log, dropping the oldest ones if needed.
+   *
+   * \param max_recorded_changes upper bound on the size of the change log
+   */
+  void set_max_recorded_changes(size_t max_recorded_changes)
+  {
+    max_recorded_changes_ = max_recorded_changes;
+    trim_changes();
+  }
+
+  /**
+   * Get all changes recorded after a given sequence number.
+   *
+   * The changes are appended to `changes` in sequence order.
+   * If some of the requested changes were already dropped from the bounded change log,
+   * the remaining ones are still appended, but the caller has to rebuild its view of the
+   * graph from the full cache.
+   *
+   * \param sequence last sequence number already seen by the caller
+   * \param changes [out] changes with a sequence number greater than `sequence`
+   * \return true if no change after `sequence` was dropped from the change log
+   */
+  bool get_changes_since(uint64_t sequence, std::vector<TopicChange> & changes) const
+  {
+    if (sequence >= sequence_) {
+      return true;
+    }
+    // changes are numbered consecutively, so the position of the first requested one is known
+    uint64_t oldest = sequence_ - changes_.size() + 1;
+    bool complete = sequence + 1 >= oldest;
+    auto first = changes_.begin();
+    if (complete) {
+      std::advance(first, static_cast<std::ptrdiff_t>(sequence + 1 - oldest));
+    }
+    changes.insert(changes.end(), first, changes_.end());
+    return complete;
+  }
+
   /**
    * Add a topic based on discovery.
    *
@@ -106,9 +209,15 @@ public:
         "unique topic attempted to be added twice, ignoring");
       return false;
     }
-    endpoint_guid_to_info_[endpoint_guid] =
-      TopicInfo {topic_name, type_name, participant_guid, endpoint_guid, qos_profile};
+    TopicInfo & info = endpoint_guid_to_info_[endpoint_guid];
+    info = TopicInfo {topic_name, type_name, participant_guid, endpoint_guid, qos_profile};
     participant_to_endpoint_guids_[participant_guid].insert(endpoint_guid);
+    topic_name_to_endpoint_guids_[topic_name].insert(endpoint_guid);
+    auto & participant_topics_types = participant_to_topics_types_[participant_guid];
+    if (++participant_topics_types.endpoint_counts[{topic_name, type_name}] == 1) {
+      participant_topics_types.topics_types[topic_name].insert(type_name);
+    }
+    record_change(TopicChangeKind::EndpointAdded, info);
     return true;
   }
 
@@ -151,9 +260,18 @@ public:
       return false;
     }
 
+    remove_participant_topic_type(participant_guid, topic_name, type_name);
+    auto topic_endpoint_guids = topic_name_to_endpoint_guids_.find(topic_name);
+    if (topic_endpoint_guids != topic_name_to_endpoint_guids_.end()) {
+      topic_endpoint_guids->second.erase(endpoint_guid);
+      if (topic_endpoint_guids->second.empty()) {
+        topic_name_to_endpoint_guids_.erase(topic_endpoint_guids);
+      }
+    }
+    record_change(TopicChangeKind::EndpointRemoved, topic_endpoint_info_it->second);
     endpoint_guid_to_info_.erase(topic_endpoint_info_it);
     participant_to_topic_guid->second.erase(topic_guid_to_remove);
-    if (participant_to_endpoint_guids_.empty()) {
+    if (participant_to_topic_guid->second.empty()) {
       participant_to_endpoint_guids_.erase(participant_to_topic_guid);
     }
     return true;
@@ -163,33 +281,71 @@ public:
    * Get topic types by guid.
    *
    * \param participant_guid to find topic types
-   * \return topic types corresponding to that guid
+   * \return topic types corresponding to that guid, valid until the cache is modified
    */
-  TopicsTypes get_topic_types_by_guid(const GUID_t & participant_guid)
+  const TopicsTypes & get_topic_types_by_guid(const GUID_t & participant_guid) const
   {
-    TopicsTypes topics_types;
-    const auto participant_to_topic_guids =
-      participant_to_endpoint_guids_.find(participant_guid);
-    if (participant_to_topic_guids == participant_to_endpoint_guids_.end()) {
-      return topics_types;
+    static const TopicsTypes empty_topics_types;
+    const auto participant_topics_types = participant_to_topics_types_.find(participant_guid);
+    if (participant_topics_types == participant_to_topics_types_.end()) {
+      return empty_topics_types;
     }
+    return participant_topics_types->second.topics_types;
+  }
 
-    for (auto & endpoint_guid : participant_to_topic_guids->second) {
-      auto topic_endpoint_info = endpoint_guid_to_info_.find(endpoint_guid);
-      if (topic_endpoint_info == endpoint_guid_to_info_.end()) {
-        continue;
-      }
-      const std::string & topic_name = topic_endpoint_info->second.topic_name;
-      auto topic_entry = topics_types.find(topic_name);
-      if (topic_entry == topics_types.end()) {
-        topics_types[topic_name] = std::set<std::string>();
-      }
-      topics_types[topic_name].insert(topic_endpoint_info->second.topic_type);
+private:
+  /**
+   * Append a change to the change log, dropping the oldest entries beyond the bound.
+   *
+   * \param kind of the change
+   * \param info of the endpoint which was added or removed
+   */
+  void record_change(TopicChangeKind kind, const TopicInfo & info)
+  {
+    changes_.push_back(TopicChange {++sequence_, kind, info});
+    trim_changes();
+  }
+
+  void trim_changes()
+  {
+    while (changes_.size() > max_recorded_changes_) {
+      changes_.pop_front();
+    }
+  }
+
+  /**
+   * Drop one endpoint from the topics and types of a participant.
+   *
+   * \param participant_guid owning the endpoint
+   * \param topic_name of the endpoint
+   * \param type_name of the endpoint
+   */
+  void remove_participant_topic_type(
+    const GUID_t & participant_guid,
+    const std::string & topic_name,
+    const std::string & type_name)
+  {
+    auto participant_topics_types = participant_to_topics_types_.find(participant_guid);
+    if (participant_topics_types == participant_to_topics_types_.end()) {
+      return;
+    }
+    auto & endpoint_counts = participant_topics_types->second.endpoint_counts;
+    auto count = endpoint_counts.find({topic_name, type_name});
+    if (count == endpoint_counts.end() || --count->second > 0) {
+      return;
+    }
+    endpoint_counts.erase(count);
+    auto & topics_types = participant_topics_types->second.topics_types;
+    auto topic_types = topics_types.find(topic_name);
+    topic_types->second.erase(type_name);
+    if (topic_types->second.empty()) {
+      topics_types.erase(topic_types);
+    }
+    if (topics_types.empty()) {
+      participant_to_topics_types_.erase(participant_topics_types);
     }
-    return topics_types;
   }
 
-private:
   /**
    * Helper function to initialize the set inside a participant map.
    *
@@ -219,6 +375,28 @@ private:
    * Map of participant GUIDS to a set of topic-type.
    */
   ParticipantToTopicEndpointGuids participant_to_endpoint_guids_;
+
+  /**
+   * Map of topic names to the GUIDs of the endpoints using them.
+   */
+  TopicNameToTopicEndpointGuids topic_name_to_endpoint_guids_;
+
+  /**
+   * Map of participant GUIDs to the topics and types of their endpoints.
+   */
+  ParticipantToTopicsTypes participant_to_topics_types_;
+
+  /**
+   * Bounded log of the most recent changes, oldest first.
+   */
+  std::deque<TopicChange> changes_;
+
+  /**
+   * Sequence number of the last recorded change.
+   */
+  uint64_t sequence_ = 0;
+
+  size_t max_recorded_changes_ = default_max_recorded_changes;
 };
 
 #endif  // RMW_CONNEXT_SHARED_CPP__TOPIC_CACHE_HPP_
@@ -0,0 +1,127 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_SHARED_CPP__TOPIC_STATISTICS_HPP_
+#define RMW_CONNEXT_SHARED_CPP__TOPIC_STATISTICS_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include "rmw_connext_shared_cpp/visibility_control.h"
+
+/**
+ * Environment variable selecting the topics for which publishers and subscriptions compute
+ * statistics inline.
+ *
+ * The value is a ';' separated list of fully qualified topic names, or `*` for every topic.
+ */
+#define RMW_CONNEXT_TOPIC_STATISTICS_ENV_VAR "RMW_CONNEXT_TOPIC_STATISTICS"
+
+/// Length of the window over which the statistics are computed.
+#define RMW_CONNEXT_TOPIC_STATISTICS_PERIOD_MS 1000
+
+/// Statistics of the messages of a publisher or subscription over the last complete window.
+struct TopicStatisticsSnapshot
+{
+  /// Length of the window in seconds, 0 until a first window completed.
+  double window;
+  /// Number of messages in the window.
+  uint64_t messages;
+  /// Messages per second.
+  double rate;
+  /// Serialized bytes per second.
+  double bytes_per_second;
+  /// Mean time between two messages in seconds.
+  double mean_period;
+  /// Standard deviation of the time between two messages in seconds.
+  double jitter;
+  /// Number of messages with a known age, only taken messages have one.
+  uint64_t aged_messages;
+  /// Mean time between the write and the take of a message in seconds.
+  double mean_age;
+  /// Largest time between the write and the take of a message in seconds.
+  double max_age;
+};
+
+/**
+ * Accumulates the statistics of the messages of a publisher or subscription.
+ *
+ * Recording only updates relaxed atomics, the accumulators are folded into a snapshot once per
+ * window by whichever call notices that the window is over.
+ */
+class TopicStatistics
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  explicit TopicStatistics(
+    std::chrono::nanoseconds period = std::chrono::milliseconds(
+      RMW_CONNEXT_TOPIC_STATISTICS_PERIOD_MS));
+
+  /// Record a message.
+  /**
+   * \param now time of the publish or take
+   * \param bytes serialized size of the message
+   * \param age_ns time since the message was written, or a negative value if unknown
+   */
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  void
+  record(Clock::time_point now, size_t bytes, int64_t age_ns);
+
+  /// Get the statistics of the last complete window.
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  TopicStatisticsSnapshot
+  get_snapshot(Clock::time_point now);
+
+private:
+  /// Fold the accumulators into a snapshot if the window is over.
+  /**
+   * The first window starts with the first call to record() or get_snapshot().
+   */
+  void roll_window(Clock::time_point now);
+
+  const int64_t period_ns_;
+  std::atomic<int64_t> window_start_ns_;
+  std::atomic<int64_t> last_arrival_ns_;
+  std::atomic<uint64_t> messages_;
+  std::atomic<uint64_t> bytes_;
+  std::atomic<uint64_t> intervals_;
+  /// Sum of the intervals between messages, in microseconds.
+  std::atomic<uint64_t> interval_sum_us_;
+  /// Sum of the squared intervals between messages, in microseconds squared.
+  std::atomic<uint64_t> interval_square_sum_us_;
+  std::atomic<uint64_t> aged_messages_;
+  std::atomic<uint64_t> age_sum_us_;
+  std::atomic<int64_t> max_age_ns_;
+
+  std::mutex snapshot_mutex_;
+  TopicStatisticsSnapshot snapshot_;
+};
+
+/// Check if a topic is selected by a value of RMW_CONNEXT_TOPIC_STATISTICS_ENV_VAR.
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+bool
+is_topic_statistics_enabled(const std::string & value, const std::string & topic_name);
+
+/// Check if a topic is selected by RMW_CONNEXT_TOPIC_STATISTICS_ENV_VAR.
+RMW_CONNEXT_SHARED_CPP_PUBLIC
+bool
+is_topic_statistics_enabled(const char * topic_name);
+
+#endif  // RMW_CONNEXT_SHARED_CPP__TOPIC_STATISTICS_HPP_
@@ -0,0 +1,66 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_CONNEXT_SHARED_CPP__TRACING_HPP_
+#define RMW_CONNEXT_SHARED_CPP__TRACING_HPP_
+
+/**
+ * Tracepoints on the publish, take, service and wait paths.
+ *
+ * They compile to nothing unless RMW_CONNEXT_TRACING is defined, which the RMW_CONNEXT_TRACING
+ * CMake option of rmw_connext_cpp does.
+ * When enabled they are USDT probes of the provider `rmw_connext`, which cost a nop while no
+ * tracer is attached and can be enabled with perf (`perf probe sdt_rmw_connext:publish`),
+ * LTTng (`lttng enable-event --userspace-probe=sdt:...`), bpftrace or SystemTap.
+ *
+ * Timestamps and durations are in nanoseconds, timestamps are taken from the system clock like
+ * the DDS source timestamp of a sample, so the events of different processes share a timeline.
+ *
+ * - publish(publisher, ros_message, serialized size, write timestamp, serialize duration,
+ *   write duration)
+ * - take(subscription, ros_message, taken, serialized size, source timestamp, take duration,
+ *   deserialize duration)
+ * - send_request(client, ros_request, sequence id, call timestamp, call duration)
+ * - take_response(client, ros_response, taken, sequence id, call timestamp, call duration)
+ * - wait(wait_set, timeout or -1 if infinite, wait timestamp, wait duration, timed out)
+ */
+
+#ifdef RMW_CONNEXT_TRACING
+
+#include <sys/sdt.h>
+
+#include <chrono>
+#include <cstdint>
+
+/// Current time of the system clock in nanoseconds.
+inline int64_t
+rmw_connext_trace_now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+#define RMW_CONNEXT_TRACING_ENABLED true
+#define RMW_CONNEXT_TRACEPOINT(event, ...) STAP_PROBEV(rmw_connext, event, __VA_ARGS__)
+#define RMW_CONNEXT_TRACE_TIMESTAMP(variable) const int64_t variable = rmw_connext_trace_now()
+
+#else
+
+#define RMW_CONNEXT_TRACING_ENABLED false
+#define RMW_CONNEXT_TRACEPOINT(event, ...)
+#define RMW_CONNEXT_TRACE_TIMESTAMP(variable)
+
+#endif  // RMW_CONNEXT_TRACING
+
+#endif  // RMW_CONNEXT_SHARED_CPP__TRACING_HPP_
@@ -26,10 +26,12 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "rmw/rmw.h"
 #include "topic_cache.hpp"
+#include "rmw_connext_shared_cpp/names_and_types_cache.hpp"
 #include "rmw_connext_shared_cpp/ndds_include.hpp"
 #include "rmw_connext_shared_cpp/visibility_control.h"
 
@@ -37,6 +39,8 @@
 enum EntityType {Publisher, Subscriber};
 
 using DDSTopicEndpointInfo = TopicCache<DDS::GUID_t>::TopicInfo;
+using DDSTopicChange = TopicCache<DDS::GUID_t>::TopicChange;
+using DDSTopicChangeKind = TopicCache<DDS::GUID_t>::TopicChangeKind;
 
 class CustomDataReaderListener
   : public DDS::DataReaderListener
@@ -87,7 +91,7 @@ public:
   void fill_topic_endpoint_infos(
     const std::string & topic_name,
     bool no_mangle,
-    std::vector<const DDSTopicEndpointInfo *> & topic_endpoint_infos);
+    std::vector<DDSTopicEndpointInfo> & topic_endpoint_infos);
 
   RMW_CONNEXT_SHARED_CPP_PUBLIC
   void fill_topic_names_and_types(
@@ -110,11 +114,38 @@ public:
     DDS_GUID_t & participant_guid,
     const std::string & suffix);
 
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  bool fill_topic_changes_since(
+    uint64_t sequence,
+    std::vector<DDSTopicChange> & topic_changes,
+    uint64_t & latest_sequence);
+
+  /// Get a counter which changes whenever an endpoint is added or removed.
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  uint64_t get_generation();
+
 protected:
   std::mutex mutex_;
   TopicCache<DDS::GUID_t> topic_cache;
+  /// Map of endpoint GUID to the service name and type, for endpoints of a ROS service.
+  std::map<DDS::GUID_t, std::pair<std::string, std::string>> service_endpoints_;
+  /// Map of service name to the number of endpoints using each service type.
+  std::map<std::string, std::map<std::string, size_t>> services_;
 
 private:
+  /// Call a function for each endpoint using a topic, the mutex has to be held.
+  template<typename Function>
+  void for_each_topic_endpoint(const std::string & topic_name, bool no_mangle, Function function);
+
+  /// Add an endpoint to the service index if it is part of a service, the mutex has to be held.
+  void add_service_endpoint(
+    const DDS::GUID_t & guid,
+    const std::string & topic_name,
+    const std::string & type_name);
+
+  /// Remove an endpoint from the service index, the mutex has to be held.
+  void remove_service_endpoint(const DDS::GUID_t & guid);
+
   rmw_guard_condition_t * graph_guard_condition_;
   const char * implementation_identifier_;
 };
@@ -143,12 +174,81 @@ public:
   virtual void on_data_available(DDS::DataReader * reader);
 };
 
+/**
+ * Node name and namespace announced by a participant in its user_data.
+ */
+struct ParticipantNameInfo
+{
+  std::string name;
+  std::string namespace_;
+};
+
+class CustomParticipantListener
+  : public DDS::DataReaderListener
+{
+public:
+  explicit
+  CustomParticipantListener(
+    const char * implementation_identifier, rmw_guard_condition_t * graph_guard_condition)
+  : graph_guard_condition_(graph_guard_condition),
+    implementation_identifier_(implementation_identifier)
+  {}
+
+  virtual void on_data_available(DDS::DataReader * reader);
+
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  bool add_information(
+    const DDS::GUID_t & participant_guid,
+    const std::string & name,
+    const std::string & namespace_);
+
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  bool remove_information(const DDS::GUID_t & participant_guid);
+
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  bool trigger_graph_guard_condition();
+
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  bool get_participant_name(
+    const DDS::GUID_t & participant_guid,
+    ParticipantNameInfo & name_info);
+
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  bool get_participant_guid(
+    const std::string & name,
+    const std::string & namespace_,
+    DDS::GUID_t & participant_guid);
+
+  RMW_CONNEXT_SHARED_CPP_PUBLIC
+  void fill_node_names(std::vector<ParticipantNameInfo> & node_names);
+
+protected:
+  std::mutex mutex_;
+  /// Map of participant GUID to the node name and namespace it announced.
+  std::map<DDS::GUID_t, ParticipantNameInfo> participant_names_;
+  /// Map of (namespace, name) to the participants announcing that node name.
+  std::map<std::pair<std::string, std::string>, std::set<DDS::GUID_t>> node_name_to_guids_;
+  /// Map of the GUID derived from the builtin topic instance handle to the participant GUID.
+  std::map<DDS::GUID_t, DDS::GUID_t> instance_to_participant_guid_;
+
+private:
+  /// Remove a participant from node_name_to_guids_, the mutex has to be held.
+  void remove_from_index(
+    const DDS::GUID_t & participant_guid,
+    const ParticipantNameInfo & name_info);
+
+  rmw_guard_condition_t * graph_guard_condition_;
+  const char * implementation_identifier_;
+};
+
 struct ConnextNodeInfo
 {
   DDS::DomainParticipant * participant;
   CustomPublisherListener * publisher_listener;
   CustomSubscriberListener * subscriber_listener;
+  CustomParticipantListener * participant_listener;
   rmw_guard_condition_t * graph_guard_condition;
+  NamesAndTypesCache names_and_types_cache;
 };
 
 struct ConnextPublisherGID
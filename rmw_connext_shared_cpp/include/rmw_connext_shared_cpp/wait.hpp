@@ -27,6 +27,7 @@
 
 #include "rmw_connext_shared_cpp/condition_error.hpp"
 #include "rmw_connext_shared_cpp/event_converter.hpp"
+#include "rmw_connext_shared_cpp/tracing.hpp"
 #include "rmw_connext_shared_cpp/types.hpp"
 #include "rmw_connext_shared_cpp/visibility_control.h"
 #include "rmw_connext_shared_cpp/connext_static_event_info.hpp"
@@ -330,7 +331,13 @@ wait(
     timeout.nanosec = static_cast<DDS::Long>(wait_timeout->nsec);
   }
 
+  RMW_CONNEXT_TRACE_TIMESTAMP(wait_start);
   DDS::ReturnCode_t status = dds_wait_set->wait(*active_conditions, timeout);
+  RMW_CONNEXT_TRACE_TIMESTAMP(wait_end);
+  RMW_CONNEXT_TRACEPOINT(
+    wait, wait_set,
+    wait_timeout ? static_cast<int64_t>(wait_timeout->sec * 1000000000ULL + wait_timeout->nsec) :
+    -1, wait_start, wait_end - wait_start, status == DDS::RETCODE_TIMEOUT);
 
   if (status != DDS::RETCODE_OK && status != DDS::RETCODE_TIMEOUT) {
     RMW_SET_ERROR_MSG("failed to wait on wait set");
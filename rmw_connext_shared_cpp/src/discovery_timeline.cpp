@@ -0,0 +1,171 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "rcutils/get_env.h"
+#include "rcutils/process.h"
+
+#include "rmw_connext_shared_cpp/discovery_timeline.hpp"
+#include "rmw_connext_shared_cpp/guid_helper.hpp"
+
+namespace
+{
+
+const char *
+__discovery_event_name(DiscoveryEvent event)
+{
+  switch (event) {
+    case DiscoveryEvent::ParticipantCreated:
+      return "participant_created";
+    case DiscoveryEvent::LocalPublisherCreated:
+      return "local_publisher_created";
+    case DiscoveryEvent::LocalSubscriberCreated:
+      return "local_subscriber_created";
+    case DiscoveryEvent::PublisherDiscovered:
+      return "publisher_discovered";
+    case DiscoveryEvent::PublisherRemoved:
+      return "publisher_removed";
+    case DiscoveryEvent::SubscriberDiscovered:
+      return "subscriber_discovered";
+    case DiscoveryEvent::SubscriberRemoved:
+      return "subscriber_removed";
+    case DiscoveryEvent::PublisherFirstMatched:
+      return "publisher_first_matched";
+    case DiscoveryEvent::SubscriberFirstMatched:
+      return "subscriber_first_matched";
+  }
+  return "unknown";
+}
+
+/**
+ * Process wide timeline, kept in memory and written to a file at exit.
+ *
+ * The timeline is never destroyed, since DDS threads may still report discovery events while
+ * the process exits.
+ */
+class DiscoveryTimeline
+{
+public:
+  DiscoveryTimeline()
+  {
+    const char * prefix = nullptr;
+    const char * error_str = rcutils_get_env(RMW_CONNEXT_DISCOVERY_TIMELINE_ENV_VAR, &prefix);
+    if (error_str) {
+      fprintf(
+        stderr, "failed to read %s: %s\n", RMW_CONNEXT_DISCOVERY_TIMELINE_ENV_VAR, error_str);
+      return;
+    }
+    if (!prefix || prefix[0] == '\0') {
+      return;
+    }
+    path_ = std::string(prefix) + std::to_string(rcutils_get_pid()) + ".csv";
+    enabled_ = true;
+  }
+
+  bool enabled() const
+  {
+    return enabled_;
+  }
+
+  void record(DiscoveryEvent event, const DDS::GUID_t & guid, const char * name)
+  {
+    auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::system_clock::now().time_since_epoch()).count();
+    std::lock_guard<std::mutex> lock(mutex_);
+    records_.push_back(Record {static_cast<int64_t>(time), event, guid, name ? name : ""});
+  }
+
+  void dump()
+  {
+    FILE * file = fopen(path_.c_str(), "w");
+    if (!file) {
+      fprintf(stderr, "failed to open discovery timeline file '%s'\n", path_.c_str());
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    fprintf(file, "time_ns,event,guid,name\n");
+    for (const auto & record : records_) {
+      std::stringstream guid_stream;
+      guid_stream << record.guid;
+      fprintf(
+        file, "%" PRId64 ",%s,%s,%s\n", record.time_ns, __discovery_event_name(record.event),
+        guid_stream.str().c_str(), record.name.c_str());
+    }
+    fclose(file);
+  }
+
+private:
+  struct Record
+  {
+    int64_t time_ns;
+    DiscoveryEvent event;
+    DDS::GUID_t guid;
+    std::string name;
+  };
+
+  bool enabled_ = false;
+  std::string path_;
+  std::mutex mutex_;
+  std::vector<Record> records_;
+};
+
+DiscoveryTimeline &
+__get_discovery_timeline()
+{
+  static DiscoveryTimeline * timeline = [] {
+      auto timeline = new DiscoveryTimeline();
+      if (timeline->enabled()) {
+        std::atexit([] {__get_discovery_timeline().dump();});
+      }
+      return timeline;
+    }();
+  return *timeline;
+}
+
+}  // namespace
+
+bool
+discovery_timeline_enabled()
+{
+  return __get_discovery_timeline().enabled();
+}
+
+void
+record_discovery_event(DiscoveryEvent event, const DDS::GUID_t & guid, const char * name)
+{
+  DiscoveryTimeline & timeline = __get_discovery_timeline();
+  if (timeline.enabled()) {
+    timeline.record(event, guid, name);
+  }
+}
+
+void
+record_discovery_event(
+  DiscoveryEvent event, const DDS::InstanceHandle_t & instance_handle, const char * name)
+{
+  DiscoveryTimeline & timeline = __get_discovery_timeline();
+  if (timeline.enabled()) {
+    DDS::GUID_t guid;
+    DDS_InstanceHandle_to_GUID(&guid, instance_handle);
+    timeline.record(event, guid, name);
+  }
+}
@@ -14,6 +14,7 @@
 
 #include <unordered_map>
 
+#include "rmw_connext_shared_cpp/connext_event_types.hpp"
 #include "rmw_connext_shared_cpp/event_converter.hpp"
 
 /// Mapping of RMW_EVENT to the corresponding DDS_StatusKind.
@@ -22,6 +23,9 @@ static const std::unordered_map<rmw_event_type_t, DDS::StatusKind> mask_map{
   {RMW_EVENT_REQUESTED_DEADLINE_MISSED, DDS_REQUESTED_DEADLINE_MISSED_STATUS},
   {RMW_EVENT_LIVELINESS_LOST, DDS_LIVELINESS_LOST_STATUS},
   {RMW_EVENT_OFFERED_DEADLINE_MISSED, DDS_OFFERED_DEADLINE_MISSED_STATUS},
+  {RMW_CONNEXT_EVENT_SAMPLE_LOST, DDS_SAMPLE_LOST_STATUS},
+  {RMW_CONNEXT_EVENT_SAMPLE_REJECTED, DDS_SAMPLE_REJECTED_STATUS},
+  {RMW_CONNEXT_EVENT_REQUESTED_INCOMPATIBLE_QOS, DDS_REQUESTED_INCOMPATIBLE_QOS_STATUS},
 };
 
 DDS::StatusKind get_status_kind_from_rmw(const rmw_event_type_t event_t)
@@ -34,6 +38,48 @@ bool is_event_supported(const rmw_event_type_t event_t)
   return mask_map.count(event_t) > 0;
 }
 
+const char * get_sample_rejected_reason_name(DDS::SampleRejectedStatusKind reason)
+{
+  switch (reason) {
+    case DDS_REJECTED_BY_INSTANCES_LIMIT:
+      return "max_instances";
+    case DDS_REJECTED_BY_SAMPLES_LIMIT:
+      return "max_samples";
+    case DDS_REJECTED_BY_SAMPLES_PER_INSTANCE_LIMIT:
+      return "max_samples_per_instance";
+    case DDS_NOT_REJECTED:
+      return "none";
+    default:
+      return "other";
+  }
+}
+
+const char * get_qos_policy_name(DDS::QosPolicyId_t policy_id)
+{
+  switch (policy_id) {
+    case DDS_DURABILITY_QOS_POLICY_ID:
+      return "durability";
+    case DDS_PRESENTATION_QOS_POLICY_ID:
+      return "presentation";
+    case DDS_DEADLINE_QOS_POLICY_ID:
+      return "deadline";
+    case DDS_LATENCYBUDGET_QOS_POLICY_ID:
+      return "latency_budget";
+    case DDS_OWNERSHIP_QOS_POLICY_ID:
+      return "ownership";
+    case DDS_LIVELINESS_QOS_POLICY_ID:
+      return "liveliness";
+    case DDS_RELIABILITY_QOS_POLICY_ID:
+      return "reliability";
+    case DDS_DESTINATIONORDER_QOS_POLICY_ID:
+      return "destination_order";
+    case DDS_INVALID_QOS_POLICY_ID:
+      return "none";
+    default:
+      return "other";
+  }
+}
+
 rmw_ret_t check_dds_ret_code(const DDS::ReturnCode_t dds_return_code)
 {
   switch (dds_return_code) {
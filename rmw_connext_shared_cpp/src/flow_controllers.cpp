@@ -0,0 +1,128 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "rmw_connext_shared_cpp/flow_controllers.hpp"
+
+namespace
+{
+
+std::vector<std::string>
+split(const std::string & value, char separator)
+{
+  std::vector<std::string> result;
+  size_t start = 0;
+  while (true) {
+    size_t end = value.find(separator, start);
+    if (end == std::string::npos) {
+      result.push_back(value.substr(start));
+      return result;
+    }
+    result.push_back(value.substr(start, end - start));
+    start = end + 1;
+  }
+}
+
+bool
+parse_size(const std::string & value, size_t & size)
+{
+  if (value.empty() || value.find_first_not_of("0123456789") != std::string::npos) {
+    return false;
+  }
+  size = std::strtoull(value.c_str(), nullptr, 10);
+  return size > 0;
+}
+
+size_t
+to_tokens(size_t bytes)
+{
+  return (bytes + RMW_CONNEXT_FLOW_CONTROLLER_BYTES_PER_TOKEN - 1) /
+         RMW_CONNEXT_FLOW_CONTROLLER_BYTES_PER_TOKEN;
+}
+
+}  // namespace
+
+bool
+parse_flow_controllers(
+  const std::string & value,
+  std::vector<FlowControllerConfig> & flow_controllers)
+{
+  flow_controllers.clear();
+  if (value.empty()) {
+    return true;
+  }
+  for (const auto & definition : split(value, ';')) {
+    if (definition.empty()) {
+      continue;
+    }
+    std::vector<std::string> fields = split(definition, ':');
+    if (fields.size() < 3 || fields.size() > 4 || fields[0].empty()) {
+      return false;
+    }
+    FlowControllerConfig flow_controller;
+    flow_controller.name = fields[0];
+    if (!parse_size(fields[1], flow_controller.bytes_per_period) ||
+      !parse_size(fields[2], flow_controller.period_ms))
+    {
+      return false;
+    }
+    flow_controller.max_burst_bytes = flow_controller.bytes_per_period;
+    if (fields.size() == 4 && !parse_size(fields[3], flow_controller.max_burst_bytes)) {
+      return false;
+    }
+    flow_controllers.push_back(flow_controller);
+  }
+  return true;
+}
+
+bool
+is_flow_controller_defined(const std::string & value, const std::string & name)
+{
+  std::vector<FlowControllerConfig> flow_controllers;
+  if (!parse_flow_controllers(value, flow_controllers)) {
+    return false;
+  }
+  for (const auto & flow_controller : flow_controllers) {
+    if (flow_controller.name == name) {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::vector<std::pair<std::string, std::string>>
+get_flow_controller_properties(const FlowControllerConfig & flow_controller)
+{
+  const std::string prefix = get_flow_controller_name(flow_controller.name) + ".token_bucket.";
+  return {
+    {prefix + "max_tokens", std::to_string(to_tokens(flow_controller.max_burst_bytes))},
+    {
+      prefix + "tokens_added_per_period",
+      std::to_string(to_tokens(flow_controller.bytes_per_period))
+    },
+    {prefix + "bytes_per_token", std::to_string(RMW_CONNEXT_FLOW_CONTROLLER_BYTES_PER_TOKEN)},
+    {prefix + "period.sec", std::to_string(flow_controller.period_ms / 1000)},
+    {prefix + "period.nanosec", std::to_string((flow_controller.period_ms % 1000) * 1000000)},
+  };
+}
+
+std::string
+get_flow_controller_name(const std::string & name)
+{
+  return "dds.flow_controller.token_bucket." + name;
+}
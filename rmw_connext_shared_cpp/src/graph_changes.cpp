@@ -0,0 +1,77 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <vector>
+
+#include "rmw/error_handling.h"
+
+#include "rmw_connext_shared_cpp/graph_changes.hpp"
+#include "rmw_connext_shared_cpp/types.hpp"
+
+static void
+__append_changes(
+  EntityType entity_type,
+  const std::vector<DDSTopicChange> & topic_changes,
+  std::vector<ConnextGraphChange> * changes)
+{
+  changes->reserve(changes->size() + topic_changes.size());
+  for (const auto & topic_change : topic_changes) {
+    changes->push_back(ConnextGraphChange {entity_type, topic_change});
+  }
+}
+
+rmw_ret_t
+get_graph_changes(
+  const char * implementation_identifier,
+  const rmw_node_t * node,
+  ConnextGraphChangeCursor * cursor,
+  std::vector<ConnextGraphChange> * changes,
+  bool * complete)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(node, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(cursor, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(changes, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(complete, RMW_RET_INVALID_ARGUMENT);
+  if (node->implementation_identifier != implementation_identifier) {
+    RMW_SET_ERROR_MSG("node handle is not from this rmw implementation");
+    return RMW_RET_ERROR;
+  }
+
+  auto node_info = static_cast<ConnextNodeInfo *>(node->data);
+  if (!node_info) {
+    RMW_SET_ERROR_MSG("node info handle is null");
+    return RMW_RET_ERROR;
+  }
+  if (!node_info->publisher_listener) {
+    RMW_SET_ERROR_MSG("publisher listener handle is null");
+    return RMW_RET_ERROR;
+  }
+  if (!node_info->subscriber_listener) {
+    RMW_SET_ERROR_MSG("subscriber listener handle is null");
+    return RMW_RET_ERROR;
+  }
+
+  std::vector<DDSTopicChange> topic_changes;
+  bool publishers_complete = node_info->publisher_listener->fill_topic_changes_since(
+    cursor->publisher_sequence, topic_changes, cursor->publisher_sequence);
+  __append_changes(EntityType::Publisher, topic_changes, changes);
+
+  topic_changes.clear();
+  bool subscribers_complete = node_info->subscriber_listener->fill_topic_changes_since(
+    cursor->subscriber_sequence, topic_changes, cursor->subscriber_sequence);
+  __append_changes(EntityType::Subscriber, topic_changes, changes);
+
+  *complete = publishers_complete && subscribers_complete;
+  return RMW_RET_OK;
+}
@@ -14,6 +14,7 @@
 
 #include "rmw_connext_shared_cpp/init.hpp"
 #include "rmw_connext_shared_cpp/ndds_include.hpp"
+#include "rmw_connext_shared_cpp/qos.hpp"
 
 #include "rmw/error_handling.h"
 
@@ -25,5 +26,9 @@ init()
     RMW_SET_ERROR_MSG("failed to get participant factory");
     return RMW_RET_ERROR;
   }
+  if (!load_qos_settings()) {
+    // error string was set within the function
+    return RMW_RET_ERROR;
+  }
   return RMW_RET_OK;
 }
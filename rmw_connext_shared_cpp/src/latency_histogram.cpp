@@ -0,0 +1,143 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <limits>
+
+#include "rmw_connext_shared_cpp/latency_histogram.hpp"
+
+constexpr size_t LatencyHistogram::sub_buckets;
+constexpr size_t LatencyHistogram::bucket_count;
+
+LatencyHistogram::LatencyHistogram()
+{
+  reset();
+}
+
+void
+LatencyHistogram::record(int64_t latency_ns)
+{
+  if (latency_ns < 0) {
+    negative_count_.fetch_add(1, std::memory_order_relaxed);
+    latency_ns = 0;
+  }
+  buckets_[get_bucket_index(latency_ns)].fetch_add(1, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+  int64_t min = min_.load(std::memory_order_relaxed);
+  while (latency_ns < min &&
+    !min_.compare_exchange_weak(min, latency_ns, std::memory_order_relaxed))
+  {
+  }
+  int64_t max = max_.load(std::memory_order_relaxed);
+  while (latency_ns > max &&
+    !max_.compare_exchange_weak(max, latency_ns, std::memory_order_relaxed))
+  {
+  }
+}
+
+uint64_t
+LatencyHistogram::get_count() const
+{
+  return count_.load(std::memory_order_relaxed);
+}
+
+uint64_t
+LatencyHistogram::get_negative_count() const
+{
+  return negative_count_.load(std::memory_order_relaxed);
+}
+
+int64_t
+LatencyHistogram::get_min() const
+{
+  int64_t min = min_.load(std::memory_order_relaxed);
+  return min == (std::numeric_limits<int64_t>::max)() ? 0 : min;
+}
+
+int64_t
+LatencyHistogram::get_max() const
+{
+  return max_.load(std::memory_order_relaxed);
+}
+
+int64_t
+LatencyHistogram::get_percentile(double percentile) const
+{
+  // sum the buckets instead of using count_, which may be updated concurrently
+  uint64_t total = 0;
+  for (const auto & bucket : buckets_) {
+    total += bucket.load(std::memory_order_relaxed);
+  }
+  if (total == 0) {
+    return 0;
+  }
+  if (percentile < 0.0) {
+    percentile = 0.0;
+  } else if (percentile > 100.0) {
+    percentile = 100.0;
+  }
+  uint64_t rank = static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(total));
+  if (rank == 0) {
+    rank = 1;
+  }
+  uint64_t seen = 0;
+  for (size_t i = 0; i < bucket_count; ++i) {
+    seen += buckets_[i].load(std::memory_order_relaxed);
+    if (seen >= rank) {
+      int64_t max = get_max();
+      int64_t upper_bound = get_bucket_upper_bound(i);
+      return upper_bound < max ? upper_bound : max;
+    }
+  }
+  return get_max();
+}
+
+void
+LatencyHistogram::reset()
+{
+  for (auto & bucket : buckets_) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+  count_.store(0, std::memory_order_relaxed);
+  negative_count_.store(0, std::memory_order_relaxed);
+  min_.store((std::numeric_limits<int64_t>::max)(), std::memory_order_relaxed);
+  max_.store(0, std::memory_order_relaxed);
+}
+
+size_t
+LatencyHistogram::get_bucket_index(int64_t latency_ns)
+{
+  if (latency_ns < static_cast<int64_t>(sub_buckets)) {
+    return latency_ns < 0 ? 0 : static_cast<size_t>(latency_ns);
+  }
+  uint64_t value = static_cast<uint64_t>(latency_ns);
+  size_t msb = 63;
+  while (!(value & (uint64_t(1) << msb))) {
+    --msb;
+  }
+  // the 3 bits below the most significant one select the sub-bucket
+  size_t sub_bucket = static_cast<size_t>(value >> (msb - 3)) & (sub_buckets - 1);
+  return sub_buckets + (msb - 3) * sub_buckets + sub_bucket;
+}
+
+int64_t
+LatencyHistogram::get_bucket_upper_bound(size_t index)
+{
+  if (index < sub_buckets) {
+    return static_cast<int64_t>(index);
+  }
+  size_t shift = (index - sub_buckets) / sub_buckets;
+  uint64_t sub_bucket = (index - sub_buckets) % sub_buckets;
+  uint64_t lower_bound = (sub_buckets + sub_bucket) << shift;
+  return static_cast<int64_t>(lower_bound + (uint64_t(1) << shift) - 1);
+}
@@ -0,0 +1,68 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstring>
+#include <mutex>
+
+#include "rmw_connext_shared_cpp/match_recorder.hpp"
+#include "rmw_connext_shared_cpp/types.hpp"
+
+constexpr size_t MatchRecorder::max_history;
+
+MatchRecorder::MatchRecorder(
+  const char * implementation_identifier, Clock::time_point creation_time)
+: implementation_identifier_(implementation_identifier),
+  creation_time_(creation_time),
+  has_matched_(false),
+  time_to_first_match_(0)
+{}
+
+bool
+MatchRecorder::record(
+  bool matched, const DDS::InstanceHandle_t & peer_handle, size_t current_count,
+  Clock::time_point now)
+{
+  MatchEvent event;
+  event.time_since_creation =
+    std::chrono::duration_cast<std::chrono::nanoseconds>(now - creation_time_);
+  event.matched = matched;
+  event.peer_gid.implementation_identifier = implementation_identifier_;
+  memset(event.peer_gid.data, 0, RMW_GID_STORAGE_SIZE);
+  // same layout as the gid of a publisher, so it can be compared with rmw_compare_gids_equal
+  auto peer_gid = reinterpret_cast<ConnextPublisherGID *>(event.peer_gid.data);
+  peer_gid->publication_handle = peer_handle;
+  event.current_count = current_count;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  bool first_match = matched && !has_matched_;
+  if (first_match) {
+    has_matched_ = true;
+    time_to_first_match_ = event.time_since_creation;
+  }
+  history_.push_back(event);
+  if (history_.size() > max_history) {
+    history_.pop_front();
+  }
+  return first_match;
+}
+
+void
+MatchRecorder::get_metrics(MatchMetrics & metrics) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  metrics.has_matched = has_matched_;
+  metrics.time_to_first_match = time_to_first_match_;
+  metrics.history.assign(history_.begin(), history_.end());
+}
@@ -0,0 +1,41 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <mutex>
+
+#include "rmw_connext_shared_cpp/names_and_types_cache.hpp"
+
+std::shared_ptr<const NamesAndTypesCache::NamesAndTypes>
+NamesAndTypesCache::get(
+  NamesAndTypesKind kind,
+  uint64_t publisher_generation,
+  uint64_t subscriber_generation,
+  const FillFunction & fill)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  Entry & entry = entries_[kind];
+  if (
+    !entry.names_and_types ||
+    entry.publisher_generation != publisher_generation ||
+    entry.subscriber_generation != subscriber_generation)
+  {
+    auto names_and_types = std::make_shared<NamesAndTypes>();
+    fill(*names_and_types);
+    entry.publisher_generation = publisher_generation;
+    entry.subscriber_generation = subscriber_generation;
+    entry.names_and_types = names_and_types;
+  }
+  return entry.names_and_types;
+}
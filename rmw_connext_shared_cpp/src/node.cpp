@@ -12,11 +12,18 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstring>
 #include <string>
+#include <vector>
 
 #include "rcutils/filesystem.h"
+#include "rcutils/get_env.h"
+#include "rcutils/logging_macros.h"
 
+#include "rmw_connext_shared_cpp/discovery_timeline.hpp"
+#include "rmw_connext_shared_cpp/flow_controllers.hpp"
 #include "rmw_connext_shared_cpp/guard_condition.hpp"
+#include "rmw_connext_shared_cpp/guid_helper.hpp"
 #include "rmw_connext_shared_cpp/ndds_include.hpp"
 #include "rmw_connext_shared_cpp/node.hpp"
 #include "rmw_connext_shared_cpp/types.hpp"
@@ -25,6 +32,57 @@
 #include "rmw/error_handling.h"
 #include "rmw/impl/cpp/macros.hpp"
 
+/// Check if localhost only nodes should use the shared memory transport only.
+static bool
+__use_shmem_only_for_localhost()
+{
+  const char * transport = nullptr;
+  const char * error_str = rcutils_get_env(RMW_CONNEXT_LOCALHOST_TRANSPORT_ENV_VAR, &transport);
+  if (error_str) {
+    RCUTILS_LOG_WARN_NAMED(
+      "rmw_connext_shared_cpp", "failed to read %s: %s",
+      RMW_CONNEXT_LOCALHOST_TRANSPORT_ENV_VAR, error_str);
+    return false;
+  }
+  if (strcmp(transport, "shmem") == 0) {
+    return true;
+  }
+  if (transport[0] != '\0' && strcmp(transport, "udp") != 0) {
+    RCUTILS_LOG_WARN_NAMED(
+      "rmw_connext_shared_cpp", "unknown value '%s' for %s, using 'udp'",
+      transport, RMW_CONNEXT_LOCALHOST_TRANSPORT_ENV_VAR);
+  }
+  return false;
+}
+
+/// Add the participant properties creating the flow controllers defined in the environment.
+static bool
+__add_flow_controller_properties(DDS::PropertyQosPolicy & property)
+{
+  const char * value = nullptr;
+  const char * error_str = rcutils_get_env(RMW_CONNEXT_FLOW_CONTROLLERS_ENV_VAR, &value);
+  if (error_str) {
+    RMW_SET_ERROR_MSG(error_str);
+    return false;
+  }
+  std::vector<FlowControllerConfig> flow_controllers;
+  if (!parse_flow_controllers(value, flow_controllers)) {
+    RMW_SET_ERROR_MSG("failed to parse " RMW_CONNEXT_FLOW_CONTROLLERS_ENV_VAR);
+    return false;
+  }
+  for (const auto & flow_controller : flow_controllers) {
+    for (const auto & name_value : get_flow_controller_properties(flow_controller)) {
+      DDS::ReturnCode_t status = DDS::PropertyQosPolicyHelper::add_property(
+        property, name_value.first.c_str(), name_value.second.c_str(), DDS::BOOLEAN_FALSE);
+      if (status != DDS::RETCODE_OK) {
+        RMW_SET_ERROR_MSG("failed to add flow controller qos property");
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 rmw_node_t *
 create_node(
   const char * implementation_identifier,
@@ -60,7 +118,19 @@ create_node(
     return NULL;
   }
 
-  if (localhost_only) {
+  bool shmem_only = localhost_only && __use_shmem_only_for_localhost();
+  if (shmem_only) {
+    // all peers are on this host, so shared memory is the only transport needed
+    participant_qos.transport_builtin.mask = DDS_TRANSPORTBUILTIN_SHMEM;
+    if (!participant_qos.discovery.initial_peers.ensure_length(1, 1)) {
+      RMW_SET_ERROR_MSG("failed to resize discovery initial peers");
+      return NULL;
+    }
+    if (!DDS_String_replace(&participant_qos.discovery.initial_peers[0], "shmem://")) {
+      RMW_SET_ERROR_MSG("failed to set shared memory discovery initial peer");
+      return NULL;
+    }
+  } else if (localhost_only) {
     status = DDS::PropertyQosPolicyHelper::add_property(
       participant_qos.property,
       "dds.transport.UDPv4.builtin.parent.allow_interfaces",
@@ -107,14 +177,16 @@ create_node(
   // forces local traffic to be sent over loopback,
   // even if a more efficient transport (such as shared memory) is installed
   // (in which case traffic will be sent over both transports)
-  status = DDS::PropertyQosPolicyHelper::add_property(
-    participant_qos.property,
-    "dds.transport.UDPv4.builtin.ignore_loopback_interface",
-    "0",
-    DDS::BOOLEAN_FALSE);
-  if (status != DDS::RETCODE_OK) {
-    RMW_SET_ERROR_MSG("failed to add qos property");
-    return NULL;
+  if (!shmem_only) {
+    status = DDS::PropertyQosPolicyHelper::add_property(
+      participant_qos.property,
+      "dds.transport.UDPv4.builtin.ignore_loopback_interface",
+      "0",
+      DDS::BOOLEAN_FALSE);
+    if (status != DDS::RETCODE_OK) {
+      RMW_SET_ERROR_MSG("failed to add qos property");
+      return NULL;
+    }
   }
   status = DDS::PropertyQosPolicyHelper::add_property(
     participant_qos.property,
@@ -126,6 +198,11 @@ create_node(
     return NULL;
   }
 
+  if (!__add_flow_controller_properties(participant_qos.property)) {
+    // error string was set within the function
+    return NULL;
+  }
+
   // Disable TypeCode since it increases discovery message size and is replaced by TypeObject
   // https://community.rti.com/kb/types-matching
   participant_qos.resource_limits.type_code_max_serialized_length = 0;
@@ -135,12 +212,15 @@ create_node(
   rmw_guard_condition_t * graph_guard_condition = nullptr;
   CustomPublisherListener * publisher_listener = nullptr;
   CustomSubscriberListener * subscriber_listener = nullptr;
+  CustomParticipantListener * participant_listener = nullptr;
   void * buf = nullptr;
 
   DDS::DomainParticipant * participant = nullptr;
   DDS::DataReader * data_reader = nullptr;
   DDS::PublicationBuiltinTopicDataDataReader * builtin_publication_datareader = nullptr;
   DDS::SubscriptionBuiltinTopicDataDataReader * builtin_subscription_datareader = nullptr;
+  DDS::ParticipantBuiltinTopicDataDataReader * builtin_participant_datareader = nullptr;
+  DDS::GUID_t participant_guid;
   DDS::Subscriber * builtin_subscriber = nullptr;
 
   rcutils_allocator_t allocator = rcutils_get_default_allocator();
@@ -283,6 +363,8 @@ create_node(
     RMW_SET_ERROR_MSG("failed to create participant");
     goto fail;
   }
+  DDS_InstanceHandle_to_GUID(&participant_guid, participant->get_instance_handle());
+  record_discovery_event(DiscoveryEvent::ParticipantCreated, participant_guid, name);
 
   builtin_subscriber = participant->get_builtin_subscriber();
   if (!builtin_subscriber) {
@@ -336,6 +418,30 @@ create_node(
   buf = nullptr;
   builtin_subscription_datareader->set_listener(subscriber_listener, DDS::DATA_AVAILABLE_STATUS);
 
+  data_reader = builtin_subscriber->lookup_datareader(DDS::PARTICIPANT_TOPIC_NAME);
+  builtin_participant_datareader =
+    static_cast<DDS::ParticipantBuiltinTopicDataDataReader *>(data_reader);
+  if (!builtin_participant_datareader) {
+    RMW_SET_ERROR_MSG("builtin participant datareader handle is null");
+    goto fail;
+  }
+
+  // setup participant listener, which keeps the node names of discovered participants
+  buf = rmw_allocate(sizeof(CustomParticipantListener));
+  if (!buf) {
+    RMW_SET_ERROR_MSG("failed to allocate memory");
+    goto fail;
+  }
+  RMW_TRY_PLACEMENT_NEW(
+    participant_listener, buf, goto fail, CustomParticipantListener,
+    implementation_identifier, graph_guard_condition)
+  buf = nullptr;
+  // the own participant is not announced on the builtin topic
+  participant_listener->add_information(participant_guid, name, namespace_);
+  builtin_participant_datareader->set_listener(participant_listener, DDS::DATA_AVAILABLE_STATUS);
+  // participants discovered before the listener was attached are already waiting in the reader
+  participant_listener->on_data_available(builtin_participant_datareader);
+
   node_handle = rmw_node_allocate();
   if (!node_handle) {
     RMW_SET_ERROR_MSG("failed to allocate memory for node handle");
@@ -370,6 +476,7 @@ create_node(
   node_info->participant = participant;
   node_info->publisher_listener = publisher_listener;
   node_info->subscriber_listener = subscriber_listener;
+  node_info->participant_listener = participant_listener;
   node_info->graph_guard_condition = graph_guard_condition;
 
   node_handle->implementation_identifier = implementation_identifier;
@@ -402,6 +509,11 @@ fail:
       subscriber_listener->~CustomSubscriberListener(), CustomSubscriberListener)
     rmw_free(subscriber_listener);
   }
+  if (participant_listener) {
+    RMW_TRY_DESTRUCTOR_FROM_WITHIN_FAILURE(
+      participant_listener->~CustomParticipantListener(), CustomParticipantListener)
+    rmw_free(participant_listener);
+  }
   if (node_handle) {
     if (node_handle->name) {
       rmw_free(const_cast<char *>(node_handle->name));
@@ -481,6 +593,12 @@ destroy_node(const char * implementation_identifier, rmw_node_t * node)
     rmw_free(node_info->subscriber_listener);
     node_info->subscriber_listener = nullptr;
   }
+  if (node_info->participant_listener) {
+    RMW_TRY_DESTRUCTOR_FROM_WITHIN_FAILURE(
+      node_info->participant_listener->~CustomParticipantListener(), CustomParticipantListener)
+    rmw_free(node_info->participant_listener);
+    node_info->participant_listener = nullptr;
+  }
   if (node_info->graph_guard_condition) {
     rmw_ret_t rmw_ret =
       destroy_guard_condition(implementation_identifier, node_info->graph_guard_condition);
@@ -491,6 +609,7 @@ destroy_node(const char * implementation_identifier, rmw_node_t * node)
     node_info->graph_guard_condition = nullptr;
   }
 
+  RMW_TRY_DESTRUCTOR_FROM_WITHIN_FAILURE(node_info->~ConnextNodeInfo(), ConnextNodeInfo)
   rmw_free(node_info);
   node->data = nullptr;
   rmw_free(const_cast<char *>(node->name));
@@ -31,7 +31,6 @@
 #include "rmw/error_handling.h"
 #include "rmw/get_topic_names_and_types.h"
 #include "rmw/impl/cpp/macros.hpp"
-#include "rmw/impl/cpp/key_value.hpp"
 #include "rmw/names_and_types.h"
 #include "rmw/rmw.h"
 
@@ -41,37 +40,6 @@
 #include "rmw_connext_shared_cpp/ndds_include.hpp"
 #include "rmw_connext_shared_cpp/guid_helper.hpp"
 
-/**
- * Check to see if a node name and namespace match the user data QoS policy
- * of a node.
- *
- * \param user_data_qos to inspect
- * \param node_name to match
- * \param node_namespace to match
- * \return true if match
- */
-bool
-__is_node_match(
-  const DDS::UserDataQosPolicy & user_data_qos,
-  const char * node_name,
-  const char * node_namespace)
-{
-  const uint8_t * buf = user_data_qos.value.get_contiguous_buffer();
-  if (buf) {
-    std::vector<uint8_t> kv(buf, buf + user_data_qos.value.length());
-    auto map = rmw::impl::cpp::parse_key_value(kv);
-    auto name_found = map.find("name");
-    auto ns_found = map.find("namespace");
-
-    if (name_found != map.end() && ns_found != map.end()) {
-      std::string name(name_found->second.begin(), name_found->second.end());
-      std::string ns(ns_found->second.begin(), ns_found->second.end());
-      return (name == node_name) && (ns == node_namespace);
-    }
-  }
-  return false;
-}
-
 /**
  * Get a DDS GUID key for the discovered participant which matches the
  * node_name and node_namepace supplied.
@@ -90,35 +58,13 @@ __get_key(
   const char * node_namespace,
   DDS::GUID_t & key)
 {
-  auto participant = node_info->participant;
-  RMW_CHECK_FOR_NULL_WITH_MSG(participant, "participant handle is null", return RMW_RET_ERROR);
+  auto participant_listener = node_info->participant_listener;
+  RMW_CHECK_FOR_NULL_WITH_MSG(
+    participant_listener, "participant listener handle is null", return RMW_RET_ERROR);
 
-  DDS::DomainParticipantQos dpqos;
-  auto dds_ret = participant->get_qos(dpqos);
-  if (dds_ret == DDS::RETCODE_OK && __is_node_match(dpqos.user_data, node_name, node_namespace)) {
-    DDS_InstanceHandle_to_GUID(&key, participant->get_instance_handle());
+  if (participant_listener->get_participant_guid(node_name, node_namespace, key)) {
     return RMW_RET_OK;
   }
-
-  DDS::InstanceHandleSeq handles;
-  if (participant->get_discovered_participants(handles) != DDS::RETCODE_OK) {
-    RMW_SET_ERROR_MSG("unable to fetch discovered participants.");
-    return RMW_RET_ERROR;
-  }
-
-  for (DDS::Long i = 0; i < handles.length(); ++i) {
-    DDS::ParticipantBuiltinTopicData pbtd;
-    auto dds_ret = participant->get_discovered_participant_data(pbtd, handles[i]);
-    if (dds_ret == DDS::RETCODE_OK) {
-      if (__is_node_match(pbtd.user_data, node_name, node_namespace)) {
-        DDS_BuiltinTopicKey_to_GUID(&key, pbtd.key);
-        return RMW_RET_OK;
-      }
-    } else {
-      RMW_SET_ERROR_MSG("unable to fetch discovered participants data.");
-      return RMW_RET_ERROR;
-    }
-  }
   RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
     "Node name not found: ns='%s', name='%s",
     node_namespace,
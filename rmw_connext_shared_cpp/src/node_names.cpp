@@ -20,7 +20,6 @@
 
 #include "rmw/convert_rcutils_ret_to_rmw_ret.h"
 #include "rmw/error_handling.h"
-#include "rmw/impl/cpp/key_value.hpp"
 #include "rmw/sanity_checks.h"
 
 #include "rmw_connext_shared_cpp/ndds_include.hpp"
@@ -46,146 +45,51 @@ get_node_names(
     return RMW_RET_ERROR;
   }
 
-  DDS::DomainParticipant * participant = static_cast<ConnextNodeInfo *>(node->data)->participant;
-  DDS::InstanceHandleSeq handles;
-
-  if (participant->get_discovered_participants(handles) != DDS::RETCODE_OK) {
-    RMW_SET_ERROR_MSG("unable to fetch discovered participants.");
+  auto node_info = static_cast<ConnextNodeInfo *>(node->data);
+  if (!node_info) {
+    RMW_SET_ERROR_MSG("node info handle is null");
     return RMW_RET_ERROR;
   }
-
-  DDS::DomainParticipantQos participant_qos;
-  DDS::ReturnCode_t status = participant->get_qos(participant_qos);
-
-  if (status != DDS::RETCODE_OK) {
-    RMW_SET_ERROR_MSG("failed to get default participant qos");
+  if (!node_info->participant_listener) {
+    RMW_SET_ERROR_MSG("participant listener handle is null");
     return RMW_RET_ERROR;
   }
 
-  rmw_ret_t final_ret = RMW_RET_OK;
-
-  auto length = handles.length() + 1;  // add yourself
+  // The participant listener only keeps participants which announced a node name,
+  // including the participant of this node.
+  std::vector<ParticipantNameInfo> names;
+  node_info->participant_listener->fill_node_names(names);
 
+  rmw_ret_t final_ret = RMW_RET_OK;
   rcutils_allocator_t allocator = rcutils_get_default_allocator();
 
-  // Pre-allocate temporary buffer for all node names & namespaces
-  // Nodes that are not created by ROS 2 could provide empty names
-  // Such names should not be returned
-  rcutils_string_array_t tmp_names_list = rcutils_get_zero_initialized_string_array();
-  rcutils_string_array_t tmp_namespaces_list = rcutils_get_zero_initialized_string_array();
-
-  int named_nodes_num = 1;
-
-  rcutils_ret_t rcutils_ret = rcutils_string_array_init(&tmp_names_list, length, &allocator);
-
+  rcutils_ret_t rcutils_ret = rcutils_string_array_init(node_names, names.size(), &allocator);
   if (rcutils_ret != RCUTILS_RET_OK) {
-    RMW_SET_ERROR_MSG(rcutils_get_error_string().str);
+    RMW_SET_ERROR_MSG("could not allocate memory for node_names output");
     final_ret = rmw_convert_rcutils_ret_to_rmw_ret(rcutils_ret);
     goto cleanup;
   }
 
-  rcutils_ret = rcutils_string_array_init(&tmp_namespaces_list, length, &allocator);
-
+  rcutils_ret = rcutils_string_array_init(node_namespaces, names.size(), &allocator);
   if (rcutils_ret != RCUTILS_RET_OK) {
-    RMW_SET_ERROR_MSG(rcutils_get_error_string().str);
-    final_ret = rmw_convert_rcutils_ret_to_rmw_ret(rcutils_ret);
-    goto cleanup;
-  }
-
-  // add yourself
-  tmp_names_list.data[0] = rcutils_strdup(participant_qos.participant_name.name, allocator);
-  if (!tmp_names_list.data[0]) {
-    RMW_SET_ERROR_MSG("could not allocate memory for a node name");
-    final_ret = rmw_convert_rcutils_ret_to_rmw_ret(rcutils_ret);
-    goto cleanup;
-  }
-  tmp_namespaces_list.data[0] = rcutils_strdup(node->namespace_, allocator);
-  if (!tmp_namespaces_list.data[0]) {
-    RMW_SET_ERROR_MSG("could not allocate memory for a node namespace");
+    RMW_SET_ERROR_MSG("could not allocate memory for node_namespaces output");
     final_ret = rmw_convert_rcutils_ret_to_rmw_ret(rcutils_ret);
     goto cleanup;
   }
 
-  for (auto i = 1; i < length; ++i) {
-    DDS::ParticipantBuiltinTopicData pbtd;
-    auto dds_ret = participant->get_discovered_participant_data(pbtd, handles[i - 1]);
-    std::string name;
-    std::string namespace_;
-    if (DDS::RETCODE_OK == dds_ret) {
-      auto data = static_cast<unsigned char *>(pbtd.user_data.value.get_contiguous_buffer());
-      std::vector<uint8_t> kv(data, data + pbtd.user_data.value.length());
-
-      auto map = rmw::impl::cpp::parse_key_value(kv);
-
-      auto name_found = map.find("name");
-      auto ns_found = map.find("namespace");
-
-      if (name_found != map.end()) {
-        name = std::string(name_found->second.begin(), name_found->second.end());
-      }
-
-      if (ns_found != map.end()) {
-        namespace_ = std::string(ns_found->second.begin(), ns_found->second.end());
-      }
-    }
-
-    // ignore discovered participants without a name
-    if (name.empty()) {
-      tmp_names_list.data[i] = nullptr;
-      tmp_namespaces_list.data[i] = nullptr;
-      continue;
-    }
-
-    tmp_names_list.data[named_nodes_num] = rcutils_strdup(name.c_str(), allocator);
-    if (!tmp_names_list.data[named_nodes_num]) {
+  for (size_t i = 0; i < names.size(); ++i) {
+    node_names->data[i] = rcutils_strdup(names[i].name.c_str(), allocator);
+    if (!node_names->data[i]) {
       RMW_SET_ERROR_MSG("could not allocate memory for a node's name");
-      final_ret = rmw_convert_rcutils_ret_to_rmw_ret(rcutils_ret);
+      final_ret = RMW_RET_BAD_ALLOC;
       goto cleanup;
     }
-
-    tmp_namespaces_list.data[named_nodes_num] = rcutils_strdup(namespace_.c_str(), allocator);
-    if (!tmp_namespaces_list.data[named_nodes_num]) {
+    node_namespaces->data[i] = rcutils_strdup(names[i].namespace_.c_str(), allocator);
+    if (!node_namespaces->data[i]) {
       RMW_SET_ERROR_MSG("could not allocate memory for a node's namespace");
-      final_ret = rmw_convert_rcutils_ret_to_rmw_ret(rcutils_ret);
+      final_ret = RMW_RET_BAD_ALLOC;
       goto cleanup;
     }
-
-    ++named_nodes_num;
-  }
-
-  // prepare actual output without empty names
-  rcutils_ret = rcutils_string_array_init(node_names, named_nodes_num, &allocator);
-  if (rcutils_ret != RCUTILS_RET_OK) {
-    RMW_SET_ERROR_MSG("could not allocate memory for node_names output");
-    final_ret = rmw_convert_rcutils_ret_to_rmw_ret(rcutils_ret);
-    goto cleanup;
-  }
-
-  rcutils_ret = rcutils_string_array_init(node_namespaces, named_nodes_num, &allocator);
-
-  if (rcutils_ret != RCUTILS_RET_OK) {
-    RMW_SET_ERROR_MSG("could not allocate memory for node_namespaces output");
-    final_ret = rmw_convert_rcutils_ret_to_rmw_ret(rcutils_ret);
-    goto cleanup;
-  }
-
-  for (auto i = 0; i < named_nodes_num; ++i) {
-    node_names->data[i] = rcutils_strdup(tmp_names_list.data[i], allocator);
-    node_namespaces->data[i] = rcutils_strdup(tmp_namespaces_list.data[i], allocator);
-  }
-
-  rcutils_ret = rcutils_string_array_fini(&tmp_names_list);
-  if (rcutils_ret != RCUTILS_RET_OK) {
-    RMW_SET_ERROR_MSG("failed to free tmp_names_list");
-    final_ret = rmw_convert_rcutils_ret_to_rmw_ret(rcutils_ret);
-    goto cleanup;
-  }
-
-  rcutils_ret = rcutils_string_array_fini(&tmp_namespaces_list);
-  if (rcutils_ret != RCUTILS_RET_OK) {
-    RMW_SET_ERROR_MSG("failed to free tmp_namespaces_list");
-    final_ret = rmw_convert_rcutils_ret_to_rmw_ret(rcutils_ret);
-    goto cleanup;
   }
 
   return RMW_RET_OK;
@@ -212,23 +116,5 @@ cleanup:
     }
   }
 
-  rcutils_ret = rcutils_string_array_fini(&tmp_names_list);
-  if (rcutils_ret != RCUTILS_RET_OK) {
-    RCUTILS_LOG_ERROR_NAMED(
-      "rmw_connext_cpp",
-      "failed to cleanup during error handling: %s", rcutils_get_error_string().str
-    );
-    rcutils_reset_error();
-  }
-
-  rcutils_ret = rcutils_string_array_fini(&tmp_namespaces_list);
-  if (rcutils_ret != RCUTILS_RET_OK) {
-    RCUTILS_LOG_ERROR_NAMED(
-      "rmw_connext_cpp",
-      "failed to cleanup during error handling: %s", rcutils_get_error_string().str
-    );
-    rcutils_reset_error();
-  }
-
   return final_ret;
 }
@@ -13,11 +13,92 @@
 // limitations under the License.
 
 #include <limits>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "rcutils/get_env.h"
+
+#include "rmw_connext_shared_cpp/flow_controllers.hpp"
 #include "rmw_connext_shared_cpp/qos.hpp"
+#include "rmw_connext_shared_cpp/resource_limits.hpp"
+#include "rmw_connext_shared_cpp/sample_size.hpp"
 
 namespace
 {
 
+/// Settings read from the environment, set once by load_qos_settings().
+struct QosSettings
+{
+  bool loaded = false;
+  /// Whether a profile was selected through RMW_CONNEXT_QOS_PROFILE_ENV_VAR.
+  bool enabled = false;
+  std::string library;
+  std::string profile;
+  bool preallocate_samples = false;
+  bool bounded_fragmented_samples = false;
+};
+
+std::mutex g_qos_settings_mutex;
+QosSettings g_qos_settings;
+
+bool
+read_env(const char * env_var, std::string & value)
+{
+  const char * env_value = nullptr;
+  const char * error_str = rcutils_get_env(env_var, &env_value);
+  if (error_str) {
+    RMW_SET_ERROR_MSG(error_str);
+    return false;
+  }
+  value = env_value;
+  return true;
+}
+
+std::vector<std::string>
+split_profile_files(const std::string & files)
+{
+  std::vector<std::string> result;
+  size_t start = 0;
+  while (start <= files.size()) {
+    size_t end = files.find(';', start);
+    if (end == std::string::npos) {
+      end = files.size();
+    }
+    if (end > start) {
+      result.push_back(files.substr(start, end - start));
+    }
+    start = end + 1;
+  }
+  return result;
+}
+
+QosSettings
+get_qos_settings()
+{
+  std::lock_guard<std::mutex> lock(g_qos_settings_mutex);
+  return g_qos_settings;
+}
+
+/// Add a property unless it is already set, e.g. by an XML QoS profile.
+bool
+add_property_if_unset(
+  DDS::PropertyQosPolicy & property,
+  const char * name,
+  const char * value)
+{
+  if (DDS::PropertyQosPolicyHelper::lookup_property(property, name)) {
+    return true;
+  }
+  DDS::ReturnCode_t status = DDS::PropertyQosPolicyHelper::add_property(
+    property, name, value, DDS::BOOLEAN_FALSE);
+  if (status != DDS::RETCODE_OK) {
+    RMW_SET_ERROR_MSG("failed to add qos property");
+    return false;
+  }
+  return true;
+}
+
 bool
 is_time_default(const rmw_time_t & time)
 {
@@ -151,35 +232,128 @@ set_entity_qos_from_profile(
 
 }  // anonymous namespace
 
+bool
+load_qos_settings()
+{
+  std::lock_guard<std::mutex> lock(g_qos_settings_mutex);
+  if (g_qos_settings.loaded) {
+    return true;
+  }
+
+  std::string files;
+  std::string profile;
+  std::string preallocate_samples;
+  std::string bounded_fragmented_samples;
+  if (!read_env(RMW_CONNEXT_QOS_PROFILE_FILES_ENV_VAR, files) ||
+    !read_env(RMW_CONNEXT_QOS_PROFILE_ENV_VAR, profile) ||
+    !read_env(RMW_CONNEXT_PREALLOCATE_SAMPLES_ENV_VAR, preallocate_samples) ||
+    !read_env(RMW_CONNEXT_BOUNDED_FRAGMENTED_SAMPLES_ENV_VAR, bounded_fragmented_samples))
+  {
+    return false;
+  }
+
+  QosSettings settings;
+  settings.loaded = true;
+  settings.preallocate_samples = preallocate_samples == "1";
+  settings.bounded_fragmented_samples = bounded_fragmented_samples == "1";
+  if (!profile.empty()) {
+    size_t separator = profile.find("::");
+    if (separator == std::string::npos || separator == 0 || separator + 2 == profile.size()) {
+      RMW_SET_ERROR_MSG(
+        "invalid value for " RMW_CONNEXT_QOS_PROFILE_ENV_VAR ", expected <library>::<profile>");
+      return false;
+    }
+    settings.enabled = true;
+    settings.library = profile.substr(0, separator);
+    settings.profile = profile.substr(separator + 2);
+  }
+
+  std::vector<std::string> urls = split_profile_files(files);
+  if (!urls.empty()) {
+    DDS::DomainParticipantFactory * dpf_ = DDS::DomainParticipantFactory::get_instance();
+    if (!dpf_) {
+      RMW_SET_ERROR_MSG("failed to get participant factory");
+      return false;
+    }
+    DDS::DomainParticipantFactoryQos factory_qos;
+    if (dpf_->get_qos(factory_qos) != DDS::RETCODE_OK) {
+      RMW_SET_ERROR_MSG("failed to get participant factory qos");
+      return false;
+    }
+    DDS::Long length = factory_qos.profile.url_profile.length();
+    if (!factory_qos.profile.url_profile.ensure_length(
+        length + static_cast<DDS::Long>(urls.size()),
+        length + static_cast<DDS::Long>(urls.size())))
+    {
+      RMW_SET_ERROR_MSG("failed to resize url profile sequence");
+      return false;
+    }
+    for (const auto & url : urls) {
+      factory_qos.profile.url_profile[length++] = DDS::String_dup(url.c_str());
+    }
+    if (dpf_->set_qos(factory_qos) != DDS::RETCODE_OK) {
+      RMW_SET_ERROR_MSG("failed to set participant factory qos");
+      return false;
+    }
+    // parse the files now, the factory keeps the parsed profiles for all later lookups
+    if (dpf_->load_profiles() != DDS::RETCODE_OK) {
+      RMW_SET_ERROR_MSG("failed to load qos profiles from " RMW_CONNEXT_QOS_PROFILE_FILES_ENV_VAR);
+      return false;
+    }
+  }
+
+  g_qos_settings = settings;
+  return true;
+}
+
 bool
 get_datareader_qos(
   DDS::DomainParticipant * participant,
   const rmw_qos_profile_t & qos_profile,
+  const char * topic_name,
+  size_t pool_buffer_max_size,
+  size_t max_serialized_size,
   DDS::DataReaderQos & datareader_qos)
 {
-  DDS::ReturnCode_t status = participant->get_default_datareader_qos(datareader_qos);
-  if (status != DDS::RETCODE_OK) {
-    RMW_SET_ERROR_MSG("failed to get default datareader qos");
-    return false;
+  DDS::ReturnCode_t status;
+  QosSettings settings = get_qos_settings();
+  bool use_profile = settings.enabled && topic_name;
+  if (use_profile) {
+    status = participant->get_datareader_qos_from_profile_w_topic_name(
+      datareader_qos, settings.library.c_str(), settings.profile.c_str(), topic_name);
+    if (status != DDS::RETCODE_OK) {
+      RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+        "failed to get datareader qos from profile '%s::%s' for topic '%s'",
+        settings.library.c_str(), settings.profile.c_str(), topic_name);
+      return false;
+    }
+  } else {
+    status = participant->get_default_datareader_qos(datareader_qos);
+    if (status != DDS::RETCODE_OK) {
+      RMW_SET_ERROR_MSG("failed to get default datareader qos");
+      return false;
+    }
   }
 
-  status = DDS::PropertyQosPolicyHelper::add_property(
-    datareader_qos.property,
-    "dds.data_reader.history.memory_manager.fast_pool.pool_buffer_max_size",
-    "4096",
-    DDS::BOOLEAN_FALSE);
-  if (status != DDS::RETCODE_OK) {
-    RMW_SET_ERROR_MSG("failed to add qos property");
+  bool bounded_fragmented_samples = settings.bounded_fragmented_samples && max_serialized_size > 0;
+  if (bounded_fragmented_samples) {
+    // reassembled samples of any size go into a pool buffer instead of a heap allocation
+    pool_buffer_max_size = max_serialized_size + RMW_CONNEXT_SERIALIZED_DATA_OVERHEAD;
+  }
+
+  if (!add_property_if_unset(
+      datareader_qos.property,
+      "dds.data_reader.history.memory_manager.fast_pool.pool_buffer_max_size",
+      std::to_string(pool_buffer_max_size).c_str()))
+  {
     return false;
   }
 
-  status = DDS::PropertyQosPolicyHelper::add_property(
-    datareader_qos.property,
-    "reader_resource_limits.dynamically_allocate_fragmented_samples",
-    "1",
-    DDS::BOOLEAN_FALSE);
-  if (status != DDS::RETCODE_OK) {
-    RMW_SET_ERROR_MSG("failed to add qos property");
+  if (!add_property_if_unset(
+      datareader_qos.property,
+      "reader_resource_limits.dynamically_allocate_fragmented_samples",
+      "1"))
+  {
     return false;
   }
 
@@ -187,6 +361,15 @@ get_datareader_qos(
     return false;
   }
 
+  if (settings.preallocate_samples) {
+    // only keep last histories are bounded, keep all histories still grow on demand
+    set_preallocated_resource_limits(datareader_qos.history, datareader_qos.resource_limits);
+  }
+
+  if (bounded_fragmented_samples) {
+    set_bounded_fragmented_samples(datareader_qos.history, datareader_qos.reader_resource_limits);
+  }
+
   return true;
 }
 
@@ -194,21 +377,35 @@ bool
 get_datawriter_qos(
   DDS::DomainParticipant * participant,
   const rmw_qos_profile_t & qos_profile,
+  const char * topic_name,
+  size_t pool_buffer_max_size,
   DDS::DataWriterQos & datawriter_qos)
 {
-  DDS::ReturnCode_t status = participant->get_default_datawriter_qos(datawriter_qos);
-  if (status != DDS::RETCODE_OK) {
-    RMW_SET_ERROR_MSG("failed to get default datawriter qos");
-    return false;
+  DDS::ReturnCode_t status;
+  QosSettings settings = get_qos_settings();
+  bool use_profile = settings.enabled && topic_name;
+  if (use_profile) {
+    status = participant->get_datawriter_qos_from_profile_w_topic_name(
+      datawriter_qos, settings.library.c_str(), settings.profile.c_str(), topic_name);
+    if (status != DDS::RETCODE_OK) {
+      RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+        "failed to get datawriter qos from profile '%s::%s' for topic '%s'",
+        settings.library.c_str(), settings.profile.c_str(), topic_name);
+      return false;
+    }
+  } else {
+    status = participant->get_default_datawriter_qos(datawriter_qos);
+    if (status != DDS::RETCODE_OK) {
+      RMW_SET_ERROR_MSG("failed to get default datawriter qos");
+      return false;
+    }
   }
 
-  status = DDS::PropertyQosPolicyHelper::add_property(
-    datawriter_qos.property,
-    "dds.data_writer.history.memory_manager.fast_pool.pool_buffer_max_size",
-    "4096",
-    DDS::BOOLEAN_FALSE);
-  if (status != DDS::RETCODE_OK) {
-    RMW_SET_ERROR_MSG("failed to add qos property");
+  if (!add_property_if_unset(
+      datawriter_qos.property,
+      "dds.data_writer.history.memory_manager.fast_pool.pool_buffer_max_size",
+      std::to_string(pool_buffer_max_size).c_str()))
+  {
     return false;
   }
 
@@ -216,13 +413,91 @@ get_datawriter_qos(
     return false;
   }
 
+  if (settings.preallocate_samples) {
+    // only keep last histories are bounded, keep all histories still grow on demand
+    set_preallocated_resource_limits(datawriter_qos.history, datawriter_qos.resource_limits);
+  }
+
   // TODO(wjwwood): conditionally use the async publish mode using a heuristic:
   //  https://github.com/ros2/rmw_connext/issues/190
+  // a profile resolves the synchronous mode unless it sets one, which can't send samples larger
+  // than a transport message, so only the flow controller of the profile is kept
   datawriter_qos.publish_mode.kind = DDS::ASYNCHRONOUS_PUBLISH_MODE_QOS;
 
   return true;
 }
 
+bool
+set_flow_controller_qos(
+  const char * flow_controller_name,
+  DDS::DataWriterQos & datawriter_qos)
+{
+  std::string flow_controllers;
+  if (!read_env(RMW_CONNEXT_FLOW_CONTROLLERS_ENV_VAR, flow_controllers)) {
+    return false;
+  }
+  // the participant only created the flow controllers of the environment variable
+  if (!is_flow_controller_defined(flow_controllers, flow_controller_name)) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+      "flow controller '%s' is not defined in " RMW_CONNEXT_FLOW_CONTROLLERS_ENV_VAR,
+      flow_controller_name);
+    return false;
+  }
+  std::string name = get_flow_controller_name(flow_controller_name);
+  if (!DDS_String_replace(&datawriter_qos.publish_mode.flow_controller_name, name.c_str())) {
+    RMW_SET_ERROR_MSG("failed to set flow controller name");
+    return false;
+  }
+  datawriter_qos.publish_mode.kind = DDS::ASYNCHRONOUS_PUBLISH_MODE_QOS;
+  return true;
+}
+
+bool
+set_batch_qos(
+  size_t max_samples,
+  size_t max_data_bytes,
+  const rmw_time_t & max_flush_delay,
+  DDS::BatchQosPolicy & batch)
+{
+  const size_t max_length = static_cast<size_t>((std::numeric_limits<DDS::Long>::max)());
+  if (max_samples > max_length || max_data_bytes > max_length) {
+    RMW_SET_ERROR_MSG("failed to set batch qos since a limit exceeds the DDS type");
+    return false;
+  }
+  batch.enable = DDS::BOOLEAN_TRUE;
+  batch.max_samples =
+    max_samples == 0 ? DDS::LENGTH_UNLIMITED : static_cast<DDS::Long>(max_samples);
+  if (max_data_bytes > 0) {
+    batch.max_data_bytes = static_cast<DDS::Long>(max_data_bytes);
+  }
+  if (is_time_default(max_flush_delay)) {
+    // nothing flushes the data writer, an incomplete batch has to be sent after a while
+    batch.max_flush_delay.sec = 0;
+    batch.max_flush_delay.nanosec = RMW_CONNEXT_BATCH_DEFAULT_MAX_FLUSH_DELAY_MS * 1000000;
+  } else {
+    batch.max_flush_delay = rmw_time_to_dds(max_flush_delay);
+  }
+  return true;
+}
+
+bool
+set_time_based_filter_qos(
+  const rmw_time_t & minimum_separation,
+  DDS::DataReaderQos & datareader_qos)
+{
+  DDS::Duration_t separation = DDS::Duration_t::from_seconds(0);
+  if (!is_time_default(minimum_separation)) {
+    separation = rmw_time_to_dds(minimum_separation);
+  }
+  // DDS rejects a reader which expects samples more often than it lets them through
+  if (DDS_Duration_compare(&separation, &datareader_qos.deadline.period) > 0) {
+    RMW_SET_ERROR_MSG("failed to set time based filter qos since it exceeds the deadline period");
+    return false;
+  }
+  datareader_qos.time_based_filter.minimum_separation = separation;
+  return true;
+}
+
 template<typename AttributeT>
 void
 dds_qos_lifespan_to_rmw_qos_lifespan(
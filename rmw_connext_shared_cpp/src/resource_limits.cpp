@@ -0,0 +1,46 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw_connext_shared_cpp/resource_limits.hpp"
+
+bool
+set_preallocated_resource_limits(
+  const DDS::HistoryQosPolicy & history,
+  DDS::ResourceLimitsQosPolicy & resource_limits)
+{
+  if (history.kind != DDS::KEEP_LAST_HISTORY_QOS || history.depth <= 0) {
+    return false;
+  }
+  resource_limits.max_instances = 1;
+  resource_limits.initial_instances = 1;
+  resource_limits.max_samples_per_instance = history.depth;
+  resource_limits.max_samples = history.depth;
+  resource_limits.initial_samples = history.depth;
+  return true;
+}
+
+bool
+set_bounded_fragmented_samples(
+  const DDS::HistoryQosPolicy & history,
+  DDS::DataReaderResourceLimitsQosPolicy & reader_resource_limits)
+{
+  if (history.kind != DDS::KEEP_LAST_HISTORY_QOS || history.depth <= 0) {
+    return false;
+  }
+  // a sample which is still being reassembled cannot be delivered once depth newer ones are
+  reader_resource_limits.max_fragmented_samples = history.depth;
+  reader_resource_limits.initial_fragmented_samples = history.depth;
+  reader_resource_limits.max_fragmented_samples_per_remote_writer = history.depth;
+  return true;
+}
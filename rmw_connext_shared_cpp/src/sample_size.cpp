@@ -0,0 +1,193 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "rmw_connext_shared_cpp/sample_size.hpp"
+
+namespace
+{
+
+/// Size of the encapsulation header in front of a CDR stream.
+const size_t encapsulation_size = 4;
+
+size_t
+align(size_t offset, size_t alignment)
+{
+  return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+size_t
+primitive_size(DDS_TCKind kind)
+{
+  switch (kind) {
+    case DDS_TK_BOOLEAN:
+    case DDS_TK_CHAR:
+    case DDS_TK_OCTET:
+      return 1;
+    case DDS_TK_SHORT:
+    case DDS_TK_USHORT:
+      return 2;
+    case DDS_TK_LONG:
+    case DDS_TK_ULONG:
+    case DDS_TK_FLOAT:
+    case DDS_TK_ENUM:
+    case DDS_TK_WCHAR:
+      return 4;
+    case DDS_TK_LONGLONG:
+    case DDS_TK_ULONGLONG:
+    case DDS_TK_DOUBLE:
+      return 8;
+    case DDS_TK_LONGDOUBLE:
+      return 16;
+    default:
+      return 0;
+  }
+}
+
+/// Advance offset past the largest sample of a type, return false if it is unbounded.
+bool
+add_max_serialized_size(const DDS::TypeCode * type_code, size_t & offset)
+{
+  DDS_ExceptionCode_t ex = DDS_NO_EXCEPTION_CODE;
+  DDS_TCKind kind = type_code->kind(ex);
+  if (ex != DDS_NO_EXCEPTION_CODE) {
+    return false;
+  }
+
+  size_t size = primitive_size(kind);
+  if (size > 0) {
+    offset = align(offset, size > 8 ? 8 : size) + size;
+    return true;
+  }
+
+  switch (kind) {
+    case DDS_TK_STRUCT:
+      {
+        DDS_UnsignedLong count = type_code->member_count(ex);
+        for (DDS_UnsignedLong i = 0; ex == DDS_NO_EXCEPTION_CODE && i < count; ++i) {
+          const DDS::TypeCode * member_type = type_code->member_type(i, ex);
+          if (ex != DDS_NO_EXCEPTION_CODE || !add_max_serialized_size(member_type, offset)) {
+            return false;
+          }
+        }
+        return ex == DDS_NO_EXCEPTION_CODE;
+      }
+    case DDS_TK_ALIAS:
+      {
+        const DDS::TypeCode * content_type = type_code->content_type(ex);
+        return ex == DDS_NO_EXCEPTION_CODE && add_max_serialized_size(content_type, offset);
+      }
+    case DDS_TK_STRING:
+    case DDS_TK_WSTRING:
+      {
+        DDS_UnsignedLong bound = type_code->length(ex);
+        if (ex != DDS_NO_EXCEPTION_CODE || bound == 0) {
+          return false;
+        }
+        size_t char_size = kind == DDS_TK_STRING ? 1 : 4;
+        // length, characters and the terminating null character
+        offset = align(offset, 4) + 4 + (bound + 1) * char_size;
+        return true;
+      }
+    case DDS_TK_SEQUENCE:
+    case DDS_TK_ARRAY:
+      {
+        size_t count = 1;
+        if (kind == DDS_TK_SEQUENCE) {
+          count = type_code->length(ex);
+          if (ex != DDS_NO_EXCEPTION_CODE || count == 0) {
+            return false;
+          }
+          offset = align(offset, 4) + 4;
+        } else {
+          DDS_UnsignedLong dimensions = type_code->array_dimension_count(ex);
+          for (DDS_UnsignedLong i = 0; ex == DDS_NO_EXCEPTION_CODE && i < dimensions; ++i) {
+            count *= type_code->array_dimension(i, ex);
+          }
+          if (ex != DDS_NO_EXCEPTION_CODE) {
+            return false;
+          }
+        }
+        const DDS::TypeCode * content_type = type_code->content_type(ex);
+        if (ex != DDS_NO_EXCEPTION_CODE) {
+          return false;
+        }
+        DDS_TCKind content_kind = content_type->kind(ex);
+        size_t element_size = primitive_size(content_kind);
+        if (ex == DDS_NO_EXCEPTION_CODE && element_size > 0) {
+          // elements of primitive types are packed after the first one is aligned
+          if (count > 0) {
+            offset = align(offset, element_size > 8 ? 8 : element_size) + count * element_size;
+          }
+          return true;
+        }
+        for (size_t i = 0; i < count; ++i) {
+          if (!add_max_serialized_size(content_type, offset)) {
+            return false;
+          }
+        }
+        return true;
+      }
+    default:
+      // unions, value types and others are not generated for ROS types
+      return false;
+  }
+}
+
+}  // namespace
+
+SampleSizeRecord *
+get_sample_size_record(const std::string & type_name)
+{
+  static std::mutex mutex;
+  // leaked on purpose, the records are used by endpoints until the process exits
+  static auto records = new std::map<std::string, SampleSizeRecord>();
+  std::lock_guard<std::mutex> lock(mutex);
+  return &(*records)[type_name];
+}
+
+size_t
+get_max_serialized_size(const DDS::TypeCode * type_code)
+{
+  if (!type_code) {
+    return 0;
+  }
+  // alignment is relative to the end of the encapsulation header
+  size_t offset = 0;
+  if (!add_max_serialized_size(type_code, offset)) {
+    return 0;
+  }
+  return encapsulation_size + offset;
+}
+
+size_t
+get_pool_buffer_max_size(size_t max_serialized_size, size_t observed_size)
+{
+  size_t size = RMW_CONNEXT_DEFAULT_POOL_BUFFER_MAX_SIZE;
+  if (max_serialized_size > 0) {
+    size = max_serialized_size + RMW_CONNEXT_SERIALIZED_DATA_OVERHEAD;
+  } else if (observed_size > 0) {
+    // leave headroom for samples growing a bit beyond the observed ones
+    size = 64;
+    while (size < observed_size + RMW_CONNEXT_SERIALIZED_DATA_OVERHEAD &&
+      size < RMW_CONNEXT_MAX_POOL_BUFFER_MAX_SIZE)
+    {
+      size *= 2;
+    }
+  }
+  return size < RMW_CONNEXT_MAX_POOL_BUFFER_MAX_SIZE ? size : RMW_CONNEXT_MAX_POOL_BUFFER_MAX_SIZE;
+}
@@ -0,0 +1,85 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <mutex>
+
+#include "rmw_connext_shared_cpp/sample_status_totals.hpp"
+
+SampleStatusTotals::SampleStatusTotals()
+: sample_lost_event_attached_(false),
+  sample_rejected_event_attached_(false),
+  samples_lost_(0),
+  samples_rejected_(0)
+{}
+
+void
+SampleStatusTotals::attach_event(DDS::StatusKind status_kind)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (status_kind == DDS_SAMPLE_LOST_STATUS) {
+    sample_lost_event_attached_ = true;
+  } else if (status_kind == DDS_SAMPLE_REJECTED_STATUS) {
+    sample_rejected_event_attached_ = true;
+  }
+}
+
+DDS::ReturnCode_t
+SampleStatusTotals::read_status(DDS::DataReader * reader, DDS::SampleLostStatus & status)
+{
+  // the lock keeps a concurrent read from storing an older total
+  std::lock_guard<std::mutex> lock(mutex_);
+  DDS::ReturnCode_t ret = reader->get_sample_lost_status(status);
+  if (ret == DDS::RETCODE_OK) {
+    samples_lost_ = status.total_count;
+  }
+  return ret;
+}
+
+DDS::ReturnCode_t
+SampleStatusTotals::read_status(DDS::DataReader * reader, DDS::SampleRejectedStatus & status)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  DDS::ReturnCode_t ret = reader->get_sample_rejected_status(status);
+  if (ret == DDS::RETCODE_OK) {
+    samples_rejected_ = status.total_count;
+  }
+  return ret;
+}
+
+DDS::ReturnCode_t
+SampleStatusTotals::get_totals(
+  DDS::DataReader * reader, uint64_t & samples_lost, uint64_t & samples_rejected)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!sample_lost_event_attached_) {
+    DDS::SampleLostStatus status;
+    DDS::ReturnCode_t ret = reader->get_sample_lost_status(status);
+    if (ret != DDS::RETCODE_OK) {
+      return ret;
+    }
+    samples_lost_ = status.total_count;
+  }
+  if (!sample_rejected_event_attached_) {
+    DDS::SampleRejectedStatus status;
+    DDS::ReturnCode_t ret = reader->get_sample_rejected_status(status);
+    if (ret != DDS::RETCODE_OK) {
+      return ret;
+    }
+    samples_rejected_ = status.total_count;
+  }
+  samples_lost = static_cast<uint64_t>(samples_lost_);
+  samples_rejected = static_cast<uint64_t>(samples_rejected_);
+  return DDS::RETCODE_OK;
+}
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstdint>
 #include <map>
 #include <set>
 #include <string>
@@ -68,15 +69,20 @@ get_service_names_and_types(
     return RMW_RET_ERROR;
   }
 
-  // combine publisher and subscriber information
-  std::map<std::string, std::set<std::string>> services;
-  node_info->publisher_listener->fill_service_names_and_types(services);
-  node_info->subscriber_listener->fill_service_names_and_types(services);
+  // combine publisher and subscriber information, reusing the last result if nothing changed
+  uint64_t publisher_generation = node_info->publisher_listener->get_generation();
+  uint64_t subscriber_generation = node_info->subscriber_listener->get_generation();
+  auto services = node_info->names_and_types_cache.get(
+    Services, publisher_generation, subscriber_generation,
+    [node_info](std::map<std::string, std::set<std::string>> & services) {
+      node_info->publisher_listener->fill_service_names_and_types(services);
+      node_info->subscriber_listener->fill_service_names_and_types(services);
+    });
 
   // Fill out service_names_and_types
-  if (!services.empty()) {
+  if (!services->empty()) {
     rmw_ret_t rmw_ret =
-      copy_services_to_names_and_types(services, allocator, service_names_and_types);
+      copy_services_to_names_and_types(*services, allocator, service_names_and_types);
     if (rmw_ret != RMW_RET_OK) {
       return rmw_ret;
     }
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstdint>
 #include <map>
 #include <set>
 #include <string>
@@ -64,15 +65,31 @@ get_topic_names_and_types(
     return RMW_RET_ERROR;
   }
 
-  // combine publisher and subscriber information
-  std::map<std::string, std::set<std::string>> topics;
-  node_info->publisher_listener->fill_topic_names_and_types(no_demangle, topics);
-  node_info->subscriber_listener->fill_topic_names_and_types(no_demangle, topics);
+  // combine publisher and subscriber information, reusing the last result if nothing changed
+  uint64_t publisher_generation = node_info->publisher_listener->get_generation();
+  uint64_t subscriber_generation = node_info->subscriber_listener->get_generation();
+  auto topics = node_info->names_and_types_cache.get(
+    no_demangle ? RawTopics : DemangledTopics, publisher_generation, subscriber_generation,
+    [node_info, no_demangle](std::map<std::string, std::set<std::string>> & topics) {
+      std::map<std::string, std::set<std::string>> mangled_topics;
+      node_info->publisher_listener->fill_topic_names_and_types(no_demangle, mangled_topics);
+      node_info->subscriber_listener->fill_topic_names_and_types(no_demangle, mangled_topics);
+      if (no_demangle) {
+        topics.swap(mangled_topics);
+        return;
+      }
+      for (const auto & topic_n_types : mangled_topics) {
+        auto & types = topics[_demangle_if_ros_topic(topic_n_types.first)];
+        for (const auto & type : topic_n_types.second) {
+          types.insert(_demangle_if_ros_type(type));
+        }
+      }
+    });
 
-  // Copy data to results handle
-  if (!topics.empty()) {
+  // Copy data to results handle, the memoized names are already demangled
+  if (!topics->empty()) {
     rmw_ret_t rmw_ret =
-      copy_topics_names_and_types(topics, allocator, no_demangle, topic_names_and_types);
+      copy_topics_names_and_types(*topics, allocator, true, topic_names_and_types);
     if (rmw_ret != RMW_RET_OK) {
       return rmw_ret;
     }
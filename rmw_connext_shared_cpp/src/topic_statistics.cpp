@@ -0,0 +1,160 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <string>
+
+#include "rcutils/get_env.h"
+#include "rcutils/logging_macros.h"
+
+#include "rmw_connext_shared_cpp/topic_statistics.hpp"
+
+namespace
+{
+
+int64_t
+to_ns(TopicStatistics::Clock::time_point time)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+}  // namespace
+
+TopicStatistics::TopicStatistics(std::chrono::nanoseconds period)
+: period_ns_(period.count()),
+  window_start_ns_(-1),
+  last_arrival_ns_(-1),
+  messages_(0),
+  bytes_(0),
+  intervals_(0),
+  interval_sum_us_(0),
+  interval_square_sum_us_(0),
+  aged_messages_(0),
+  age_sum_us_(0),
+  max_age_ns_(0),
+  snapshot_()
+{}
+
+void
+TopicStatistics::record(Clock::time_point now, size_t bytes, int64_t age_ns)
+{
+  roll_window(now);
+  int64_t now_ns = to_ns(now);
+  messages_.fetch_add(1, std::memory_order_relaxed);
+  bytes_.fetch_add(bytes, std::memory_order_relaxed);
+  int64_t last_arrival_ns = last_arrival_ns_.exchange(now_ns, std::memory_order_relaxed);
+  if (last_arrival_ns >= 0 && now_ns >= last_arrival_ns) {
+    uint64_t interval_us = static_cast<uint64_t>(now_ns - last_arrival_ns) / 1000;
+    intervals_.fetch_add(1, std::memory_order_relaxed);
+    interval_sum_us_.fetch_add(interval_us, std::memory_order_relaxed);
+    interval_square_sum_us_.fetch_add(interval_us * interval_us, std::memory_order_relaxed);
+  }
+  if (age_ns >= 0) {
+    aged_messages_.fetch_add(1, std::memory_order_relaxed);
+    age_sum_us_.fetch_add(static_cast<uint64_t>(age_ns) / 1000, std::memory_order_relaxed);
+    int64_t max_age_ns = max_age_ns_.load(std::memory_order_relaxed);
+    while (age_ns > max_age_ns &&
+      !max_age_ns_.compare_exchange_weak(max_age_ns, age_ns, std::memory_order_relaxed))
+    {
+    }
+  }
+}
+
+TopicStatisticsSnapshot
+TopicStatistics::get_snapshot(Clock::time_point now)
+{
+  roll_window(now);
+  std::lock_guard<std::mutex> lock(snapshot_mutex_);
+  return snapshot_;
+}
+
+void
+TopicStatistics::roll_window(Clock::time_point now)
+{
+  int64_t now_ns = to_ns(now);
+  int64_t window_start_ns = window_start_ns_.load(std::memory_order_relaxed);
+  if (window_start_ns < 0) {
+    // the first window starts with the first call
+    window_start_ns_.compare_exchange_strong(window_start_ns, now_ns, std::memory_order_relaxed);
+    return;
+  }
+  if (now_ns - window_start_ns < period_ns_) {
+    return;
+  }
+  // only the caller which moves the window start folds the accumulators
+  if (!window_start_ns_.compare_exchange_strong(
+      window_start_ns, now_ns, std::memory_order_relaxed))
+  {
+    return;
+  }
+  TopicStatisticsSnapshot snapshot{};
+  snapshot.window = static_cast<double>(now_ns - window_start_ns) / 1e9;
+  snapshot.messages = messages_.exchange(0, std::memory_order_relaxed);
+  uint64_t bytes = bytes_.exchange(0, std::memory_order_relaxed);
+  snapshot.rate = static_cast<double>(snapshot.messages) / snapshot.window;
+  snapshot.bytes_per_second = static_cast<double>(bytes) / snapshot.window;
+  uint64_t intervals = intervals_.exchange(0, std::memory_order_relaxed);
+  uint64_t interval_sum_us = interval_sum_us_.exchange(0, std::memory_order_relaxed);
+  uint64_t interval_square_sum_us = interval_square_sum_us_.exchange(0, std::memory_order_relaxed);
+  if (intervals > 0) {
+    double mean_us = static_cast<double>(interval_sum_us) / static_cast<double>(intervals);
+    double variance_us =
+      static_cast<double>(interval_square_sum_us) / static_cast<double>(intervals) -
+      mean_us * mean_us;
+    snapshot.mean_period = mean_us / 1e6;
+    snapshot.jitter = variance_us > 0.0 ? std::sqrt(variance_us) / 1e6 : 0.0;
+  }
+  snapshot.aged_messages = aged_messages_.exchange(0, std::memory_order_relaxed);
+  uint64_t age_sum_us = age_sum_us_.exchange(0, std::memory_order_relaxed);
+  int64_t max_age_ns = max_age_ns_.exchange(0, std::memory_order_relaxed);
+  if (snapshot.aged_messages > 0) {
+    snapshot.mean_age =
+      static_cast<double>(age_sum_us) / static_cast<double>(snapshot.aged_messages) / 1e6;
+    snapshot.max_age = static_cast<double>(max_age_ns) / 1e9;
+  }
+  std::lock_guard<std::mutex> lock(snapshot_mutex_);
+  snapshot_ = snapshot;
+}
+
+bool
+is_topic_statistics_enabled(const std::string & value, const std::string & topic_name)
+{
+  size_t start = 0;
+  while (start <= value.size()) {
+    size_t end = value.find(';', start);
+    if (end == std::string::npos) {
+      end = value.size();
+    }
+    std::string entry = value.substr(start, end - start);
+    if (entry == "*" || (!entry.empty() && entry == topic_name)) {
+      return true;
+    }
+    start = end + 1;
+  }
+  return false;
+}
+
+bool
+is_topic_statistics_enabled(const char * topic_name)
+{
+  const char * value = nullptr;
+  const char * error_str = rcutils_get_env(RMW_CONNEXT_TOPIC_STATISTICS_ENV_VAR, &value);
+  if (error_str) {
+    RCUTILS_LOG_WARN_NAMED(
+      "rmw_connext_shared_cpp", "failed to read %s: %s",
+      RMW_CONNEXT_TOPIC_STATISTICS_ENV_VAR, error_str);
+    return false;
+  }
+  return is_topic_statistics_enabled(value, topic_name);
+}
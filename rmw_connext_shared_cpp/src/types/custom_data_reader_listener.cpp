@@ -43,6 +43,9 @@ bool CustomDataReaderListener::add_information(
 
   // store topic name and type name
   bool success = topic_cache.add_topic(participant_guid, guid, topic_name, type_name, qos_profile);
+  if (success) {
+    add_service_endpoint(guid, topic_name, type_name);
+  }
 
 #ifdef DISCOVERY_DEBUG_LOGGING
   std::stringstream ss;
@@ -67,6 +70,9 @@ bool CustomDataReaderListener::remove_information(
 
   // remove entries
   bool success = topic_cache.remove_topic(guid);
+  if (success) {
+    remove_service_endpoint(guid);
+  }
 
 #ifdef DISCOVERY_DEBUG_LOGGING
   std::stringstream ss;
@@ -116,32 +122,56 @@ bool CustomDataReaderListener::trigger_graph_guard_condition()
   return true;
 }
 
+template<typename Function>
+void CustomDataReaderListener::for_each_topic_endpoint(
+  const std::string & topic_name,
+  bool no_mangle,
+  Function function)
+{
+  const auto & endpoint_guid_to_info = topic_cache.get_topic_endpoint_guid_to_info();
+  auto for_each_endpoint_of = [&](const std::string & fqdn) {
+      for (const auto & endpoint_guid : topic_cache.get_topic_endpoint_guids(fqdn)) {
+        function(endpoint_guid_to_info.at(endpoint_guid));
+      }
+    };
+  if (no_mangle) {
+    for_each_endpoint_of(topic_name);
+    return;
+  }
+  // A demangled name is matched by the topics which demangle to it: the name itself if it
+  // is not mangled, and the name behind any of the ROS prefixes.
+  if (_get_ros_prefix_if_exists(topic_name).empty()) {
+    for_each_endpoint_of(topic_name);
+  }
+  if (!topic_name.empty() && topic_name[0] == '/') {
+    for (const auto & prefix : _get_all_ros_prefixes()) {
+      for_each_endpoint_of(prefix + topic_name);
+    }
+  }
+}
+
 size_t CustomDataReaderListener::count_topic(const std::string & topic_name)
 {
   std::lock_guard<std::mutex> lock(mutex_);
-  auto count = std::count_if(
-    topic_cache.get_topic_endpoint_guid_to_info().begin(),
-    topic_cache.get_topic_endpoint_guid_to_info().end(),
-    [&](auto tnt) -> bool {
-      auto fqdn = _demangle_if_ros_topic(tnt.second.topic_name);
-      return fqdn == topic_name;
+  size_t count = 0;
+  for_each_topic_endpoint(
+    topic_name, false, [&count](const DDSTopicEndpointInfo &) {
+      ++count;
     });
-  return (size_t) count;
+  return count;
 }
 
 void CustomDataReaderListener::fill_topic_endpoint_infos(
   const std::string & topic_name,
   bool no_mangle,
-  std::vector<const DDSTopicEndpointInfo *> & topic_endpoint_infos)
+  std::vector<DDSTopicEndpointInfo> & topic_endpoint_infos)
 {
   std::lock_guard<std::mutex> lock(mutex_);
-  for (const auto & key_val : topic_cache.get_topic_endpoint_guid_to_info()) {
-    auto fqdn = no_mangle ? key_val.second.topic_name : _demangle_if_ros_topic(
-      key_val.second.topic_name);
-    if (fqdn == topic_name) {
-      topic_endpoint_infos.push_back(&key_val.second);
-    }
-  }
+  // copy the information, the cache may change as soon as the lock is released
+  for_each_topic_endpoint(
+    topic_name, no_mangle, [&topic_endpoint_infos](const DDSTopicEndpointInfo & info) {
+      topic_endpoint_infos.push_back(info);
+    });
 }
 
 void CustomDataReaderListener::fill_topic_names_and_types(
@@ -163,15 +193,11 @@ void
 CustomDataReaderListener::fill_service_names_and_types(
   std::map<std::string, std::set<std::string>> & services)
 {
-  for (auto it : topic_cache.get_topic_endpoint_guid_to_info()) {
-    std::string service_name = _demangle_service_from_topic(it.second.topic_name);
-    if (service_name.empty()) {
-      // not a service
-      continue;
-    }
-    std::string service_type = _demangle_service_type_only(it.second.topic_type);
-    if (!service_type.empty()) {
-      services[service_name].insert(service_type);
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto & service_n_types : services_) {
+    auto & service_types = services[service_n_types.first];
+    for (const auto & type_n_count : service_n_types.second) {
+      service_types.insert(type_n_count.first);
     }
   }
 }
@@ -233,3 +259,59 @@ void CustomDataReaderListener::fill_service_names_and_types_by_guid(
     }
   }
 }
+
+bool CustomDataReaderListener::fill_topic_changes_since(
+  uint64_t sequence,
+  std::vector<DDSTopicChange> & topic_changes,
+  uint64_t & latest_sequence)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  latest_sequence = topic_cache.get_sequence();
+  return topic_cache.get_changes_since(sequence, topic_changes);
+}
+
+uint64_t CustomDataReaderListener::get_generation()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  // every add and remove is recorded in the change log, so its sequence number is a generation
+  return topic_cache.get_sequence();
+}
+
+void CustomDataReaderListener::add_service_endpoint(
+  const DDS::GUID_t & guid,
+  const std::string & topic_name,
+  const std::string & type_name)
+{
+  std::string service_name = _demangle_service_from_topic(topic_name);
+  if (service_name.empty()) {
+    // not a service
+    return;
+  }
+  std::string service_type = _demangle_service_type_only(type_name);
+  if (service_type.empty()) {
+    return;
+  }
+  ++services_[service_name][service_type];
+  service_endpoints_[guid] = {service_name, service_type};
+}
+
+void CustomDataReaderListener::remove_service_endpoint(const DDS::GUID_t & guid)
+{
+  auto service_endpoint = service_endpoints_.find(guid);
+  if (service_endpoint == service_endpoints_.end()) {
+    return;
+  }
+  const std::string & service_name = service_endpoint->second.first;
+  const std::string & service_type = service_endpoint->second.second;
+  auto service_types = services_.find(service_name);
+  if (service_types != services_.end()) {
+    auto type_count = service_types->second.find(service_type);
+    if (type_count != service_types->second.end() && --type_count->second == 0) {
+      service_types->second.erase(type_count);
+      if (service_types->second.empty()) {
+        services_.erase(service_types);
+      }
+    }
+  }
+  service_endpoints_.erase(service_endpoint);
+}
@@ -0,0 +1,216 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "rmw/error_handling.h"
+#include "rmw/impl/cpp/key_value.hpp"
+
+#include "rmw_connext_shared_cpp/guid_helper.hpp"
+#include "rmw_connext_shared_cpp/trigger_guard_condition.hpp"
+#include "rmw_connext_shared_cpp/types.hpp"
+
+/**
+ * Extract the node name and namespace from the user data QoS policy of a participant.
+ *
+ * \param user_data_qos to inspect
+ * \param name [out] node name, if found
+ * \param namespace_ [out] node namespace, if found
+ * \return true if a non-empty node name was found
+ */
+static bool
+__parse_node_name(
+  const DDS::UserDataQosPolicy & user_data_qos,
+  std::string & name,
+  std::string & namespace_)
+{
+  const uint8_t * buf = user_data_qos.value.get_contiguous_buffer();
+  if (!buf) {
+    return false;
+  }
+  std::vector<uint8_t> kv(buf, buf + user_data_qos.value.length());
+  auto map = rmw::impl::cpp::parse_key_value(kv);
+  auto name_found = map.find("name");
+  auto ns_found = map.find("namespace");
+  if (name_found != map.end()) {
+    name = std::string(name_found->second.begin(), name_found->second.end());
+  }
+  if (ns_found != map.end()) {
+    namespace_ = std::string(ns_found->second.begin(), ns_found->second.end());
+  }
+  return !name.empty();
+}
+
+void CustomParticipantListener::on_data_available(DDS::DataReader * reader)
+{
+  DDS::ParticipantBuiltinTopicDataDataReader * builtin_reader =
+    DDS::ParticipantBuiltinTopicDataDataReader::narrow(reader);
+
+  if (!builtin_reader) {
+    fprintf(stderr, "failed to narrow to DDS::ParticipantBuiltinTopicDataDataReader\n");
+    return;
+  }
+
+  DDS::ParticipantBuiltinTopicDataSeq data_seq;
+  DDS::SampleInfoSeq info_seq;
+  DDS::ReturnCode_t retcode = builtin_reader->take(
+    data_seq, info_seq, DDS::LENGTH_UNLIMITED,
+    DDS::ANY_SAMPLE_STATE, DDS::ANY_VIEW_STATE, DDS::ANY_INSTANCE_STATE);
+
+  if (retcode == DDS::RETCODE_NO_DATA) {
+    return;
+  }
+  if (retcode != DDS::RETCODE_OK) {
+    fprintf(stderr, "failed to access data from the built-in reader\n");
+    return;
+  }
+
+  bool changed = false;
+  for (auto i = 0; i < data_seq.length(); ++i) {
+    // disposed samples carry no valid key, so remember which participant an instance refers to
+    DDS::GUID_t instance_guid;
+    DDS_InstanceHandle_to_GUID(&instance_guid, info_seq[i].instance_handle);
+    if (info_seq[i].valid_data &&
+      info_seq[i].instance_state == DDS::ALIVE_INSTANCE_STATE)
+    {
+      DDS::GUID_t participant_guid;
+      DDS_BuiltinTopicKey_to_GUID(&participant_guid, data_seq[i].key);
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        instance_to_participant_guid_[instance_guid] = participant_guid;
+      }
+
+      std::string name;
+      std::string namespace_;
+      if (__parse_node_name(data_seq[i].user_data, name, namespace_)) {
+        changed |= add_information(participant_guid, name, namespace_);
+      } else {
+        // participants which are not ROS nodes are not tracked
+        changed |= remove_information(participant_guid);
+      }
+    } else {
+      DDS::GUID_t participant_guid;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = instance_to_participant_guid_.find(instance_guid);
+        if (it == instance_to_participant_guid_.end()) {
+          continue;
+        }
+        participant_guid = it->second;
+        instance_to_participant_guid_.erase(it);
+      }
+      changed |= remove_information(participant_guid);
+    }
+  }
+
+  if (changed) {
+    this->trigger_graph_guard_condition();
+  }
+
+  builtin_reader->return_loan(data_seq, info_seq);
+}
+
+bool CustomParticipantListener::add_information(
+  const DDS::GUID_t & participant_guid,
+  const std::string & name,
+  const std::string & namespace_)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = participant_names_.find(participant_guid);
+  if (it != participant_names_.end()) {
+    if (it->second.name == name && it->second.namespace_ == namespace_) {
+      return false;
+    }
+    remove_from_index(participant_guid, it->second);
+  }
+  participant_names_[participant_guid] = ParticipantNameInfo {name, namespace_};
+  node_name_to_guids_[{namespace_, name}].insert(participant_guid);
+  return true;
+}
+
+bool CustomParticipantListener::remove_information(const DDS::GUID_t & participant_guid)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = participant_names_.find(participant_guid);
+  if (it == participant_names_.end()) {
+    return false;
+  }
+  remove_from_index(participant_guid, it->second);
+  participant_names_.erase(it);
+  return true;
+}
+
+bool CustomParticipantListener::trigger_graph_guard_condition()
+{
+  rmw_ret_t ret = trigger_guard_condition(implementation_identifier_, graph_guard_condition_);
+  if (ret != RMW_RET_OK) {
+    fprintf(stderr, "failed to trigger graph guard condition: %s\n", rmw_get_error_string().str);
+    return false;
+  }
+  return true;
+}
+
+bool CustomParticipantListener::get_participant_name(
+  const DDS::GUID_t & participant_guid,
+  ParticipantNameInfo & name_info)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = participant_names_.find(participant_guid);
+  if (it == participant_names_.end()) {
+    return false;
+  }
+  name_info = it->second;
+  return true;
+}
+
+bool CustomParticipantListener::get_participant_guid(
+  const std::string & name,
+  const std::string & namespace_,
+  DDS::GUID_t & participant_guid)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = node_name_to_guids_.find({namespace_, name});
+  if (it == node_name_to_guids_.end()) {
+    return false;
+  }
+  // several participants may announce the same node name, pick one deterministically
+  participant_guid = *it->second.begin();
+  return true;
+}
+
+void CustomParticipantListener::fill_node_names(std::vector<ParticipantNameInfo> & node_names)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  node_names.reserve(node_names.size() + participant_names_.size());
+  for (const auto & it : participant_names_) {
+    node_names.push_back(it.second);
+  }
+}
+
+void CustomParticipantListener::remove_from_index(
+  const DDS::GUID_t & participant_guid,
+  const ParticipantNameInfo & name_info)
+{
+  auto it = node_name_to_guids_.find({name_info.namespace_, name_info.name});
+  if (it == node_name_to_guids_.end()) {
+    return;
+  }
+  it->second.erase(participant_guid);
+  if (it->second.empty()) {
+    node_name_to_guids_.erase(it);
+  }
+}
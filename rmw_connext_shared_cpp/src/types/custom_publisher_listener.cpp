@@ -14,6 +14,7 @@
 
 #include <string>
 
+#include "rmw_connext_shared_cpp/discovery_timeline.hpp"
 #include "rmw_connext_shared_cpp/guid_helper.hpp"
 #include "rmw_connext_shared_cpp/qos.hpp"
 #include "rmw_connext_shared_cpp/types.hpp"
@@ -57,6 +58,7 @@ void CustomPublisherListener::on_data_available(DDS::DataReader * reader)
       rmw_qos_profile_t qos_profile;
       dds_remote_qos_to_rmw_qos(data_seq[i], &qos_profile);
 
+      record_discovery_event(DiscoveryEvent::PublisherDiscovered, guid, data_seq[i].topic_name);
       add_information(
         participant_guid,
         guid,
@@ -65,6 +67,7 @@ void CustomPublisherListener::on_data_available(DDS::DataReader * reader)
         qos_profile,
         EntityType::Publisher);
     } else {
+      record_discovery_event(DiscoveryEvent::PublisherRemoved, guid, nullptr);
       remove_information(
         guid,
         EntityType::Publisher);
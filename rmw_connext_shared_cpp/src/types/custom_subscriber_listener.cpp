@@ -14,6 +14,7 @@
 
 #include <string>
 
+#include "rmw_connext_shared_cpp/discovery_timeline.hpp"
 #include "rmw_connext_shared_cpp/guid_helper.hpp"
 #include "rmw_connext_shared_cpp/qos.hpp"
 #include "rmw_connext_shared_cpp/types.hpp"
@@ -55,6 +56,7 @@ void CustomSubscriberListener::on_data_available(DDS::DataReader * reader)
       rmw_qos_profile_t qos_profile;
       dds_remote_qos_to_rmw_qos(data_seq[i], &qos_profile);
 
+      record_discovery_event(DiscoveryEvent::SubscriberDiscovered, guid, data_seq[i].topic_name);
       add_information(
         participant_guid,
         guid,
@@ -63,6 +65,7 @@ void CustomSubscriberListener::on_data_available(DDS::DataReader * reader)
         qos_profile,
         EntityType::Subscriber);
     } else {
+      record_discovery_event(DiscoveryEvent::SubscriberRemoved, guid, nullptr);
       remove_information(
         guid,
         EntityType::Subscriber);
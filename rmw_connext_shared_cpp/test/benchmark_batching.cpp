@@ -0,0 +1,193 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Throughput of small samples with and without writer side batching, see set_batch_qos().
+//
+// Two localhost only nodes of the same process exchange Connext builtin octets samples on a
+// reliable topic, with the qos a publisher and a subscription get from the rmw and the batching
+// publisher options. A batch is flushed when it is full or after the flush delay:
+//
+//   benchmark_batching [--samples N] [--size BYTES] [--batch-samples N] [--batch-bytes BYTES]
+//     [--flush-delay-us US] [--domain ID]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <thread>
+#include <vector>
+
+#include "rmw/error_handling.h"
+#include "rmw/qos_profiles.h"
+
+#include "rmw_connext_shared_cpp/qos.hpp"
+#include "rmw_connext_shared_cpp/sample_size.hpp"
+
+#include "test_helpers.hpp"
+
+namespace
+{
+
+const char * const benchmark_identifier = "benchmark_batching";
+const char * const topic_name = "benchmark_octets";
+
+struct Options
+{
+  size_t samples = 1000000;
+  size_t size = 64;
+  size_t batch_samples = 0;
+  size_t batch_bytes = 8192;
+  size_t flush_delay_us = 1000;
+  size_t domain = 42;
+};
+
+struct Result
+{
+  double seconds;
+  double cpu_seconds;
+  size_t received;
+};
+
+Options
+parse_options(int argc, char ** argv)
+{
+  Options options;
+  parse_flags(
+    argc, argv, {
+      {"--samples", &options.samples},
+      {"--size", &options.size},
+      {"--batch-samples", &options.batch_samples},
+      {"--batch-bytes", &options.batch_bytes},
+      {"--flush-delay-us", &options.flush_delay_us},
+      {"--domain", &options.domain},
+    });
+  return options;
+}
+
+/// Send `samples` samples from `sender` to `receiver` and wait until all of them arrived.
+bool
+run(
+  DDS::DomainParticipant * sender, DDS::DomainParticipant * receiver, const Options & options,
+  bool batching, Result & result)
+{
+  DDS::Topic * sender_topic = create_octets_topic(sender, topic_name);
+  DDS::Topic * receiver_topic = create_octets_topic(receiver, topic_name);
+  if (!sender_topic || !receiver_topic) {
+    fprintf(stderr, "failed to create the topics\n");
+    return false;
+  }
+
+  // the qos of a reliable keep all publisher and subscription without an XML profile
+  rmw_qos_profile_t qos_profile = rmw_qos_profile_default;
+  qos_profile.history = RMW_QOS_POLICY_HISTORY_KEEP_ALL;
+  size_t pool_buffer_max_size = get_pool_buffer_max_size(0, options.size);
+  DDS::DataWriterQos writer_qos;
+  DDS::DataReaderQos reader_qos;
+  if (!get_datawriter_qos(sender, qos_profile, topic_name, pool_buffer_max_size, writer_qos) ||
+    !get_datareader_qos(receiver, qos_profile, topic_name, pool_buffer_max_size, 0, reader_qos))
+  {
+    fprintf(stderr, "failed to get the qos: %s\n", rmw_get_error_string().str);
+    return false;
+  }
+  if (batching) {
+    rmw_time_t flush_delay;
+    flush_delay.sec = options.flush_delay_us / 1000000;
+    flush_delay.nsec = (options.flush_delay_us % 1000000) * 1000;
+    if (!set_batch_qos(
+        options.batch_samples, options.batch_bytes, flush_delay, writer_qos.batch))
+    {
+      fprintf(stderr, "failed to set the batch qos: %s\n", rmw_get_error_string().str);
+      return false;
+    }
+  }
+  DDS::DataWriter * writer = sender->create_datawriter(
+    sender_topic, writer_qos, nullptr, DDS_STATUS_MASK_NONE);
+  DDS::DataReader * reader = receiver->create_datareader(
+    receiver_topic, reader_qos, nullptr, DDS_STATUS_MASK_NONE);
+  DDSOctetsDataWriter * octets_writer = DDSOctetsDataWriter::narrow(writer);
+  DDSOctetsDataReader * octets_reader = DDSOctetsDataReader::narrow(reader);
+  if (!octets_writer || !octets_reader) {
+    fprintf(stderr, "failed to create the data writer and reader\n");
+    return false;
+  }
+
+  if (!wait_for_matched_readers(writer)) {
+    fprintf(stderr, "the data writer and reader did not match\n");
+    return false;
+  }
+
+  std::vector<unsigned char> payload(options.size, 0x2a);
+  result.received = 0;
+  std::clock_t cpu_start = std::clock();
+  auto start = std::chrono::steady_clock::now();
+  std::thread receiving_thread([&]() {
+      DDS_OctetsSeq data_seq;
+      DDS::SampleInfoSeq info_seq;
+      auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+      while (result.received < options.samples && std::chrono::steady_clock::now() < deadline) {
+        if (octets_reader->take(
+            data_seq, info_seq, DDS_LENGTH_UNLIMITED, DDS_ANY_SAMPLE_STATE,
+            DDS_ANY_VIEW_STATE, DDS_ANY_INSTANCE_STATE) != DDS_RETCODE_OK)
+        {
+          std::this_thread::yield();
+          continue;
+        }
+        for (int i = 0; i < data_seq.length(); ++i) {
+          if (info_seq[i].valid_data) {
+            ++result.received;
+          }
+        }
+        octets_reader->return_loan(data_seq, info_seq);
+      }
+    });
+  for (size_t i = 0; i < options.samples; ++i) {
+    octets_writer->write(
+      payload.data(), static_cast<int>(payload.size()), DDS_HANDLE_NIL);
+  }
+  // send the last incomplete batch right away instead of waiting for the flush delay
+  octets_writer->flush();
+  receiving_thread.join();
+  result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  result.cpu_seconds = static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  const Options options = parse_options(argc, argv);
+
+  printf(
+    "%zu samples of %zu bytes, reliable keep all, batches of up to %zu samples and %zu bytes "
+    "flushed after %zu us\n\n%-10s %10s %12s %12s %10s\n",
+    options.samples, options.size, options.batch_samples, options.batch_bytes,
+    options.flush_delay_us, "batching", "received", "samples/s", "MB/s", "cpu s");
+  for (bool batching : {false, true}) {
+    NodePair nodes(benchmark_identifier, options.domain);
+    if (!nodes.is_valid()) {
+      fprintf(stderr, "failed to create the nodes: %s\n", rmw_get_error_string().str);
+      return EXIT_FAILURE;
+    }
+    Result result;
+    if (!run(nodes.sender(), nodes.receiver(), options, batching, result)) {
+      return EXIT_FAILURE;
+    }
+    printf(
+      "%-10s %10zu %12.0f %12.1f %10.2f\n", batching ? "on" : "off", result.received,
+      result.received / result.seconds,
+      result.received * options.size / result.seconds / (1024 * 1024), result.cpu_seconds);
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,343 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Discovery-scale benchmark of the graph cache.
+//
+// Synthesizes endpoints with fake GUIDs spread over many participants and drives the discovery
+// listeners from concurrent threads, without creating any Connext entity, so changes to the
+// graph layer can be measured locally:
+//
+//   benchmark_discovery [--endpoints N] [--participants N] [--topics N] [--threads N]
+//                       [--queries N]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#include "rmw/types.h"
+
+#include "rmw_connext_shared_cpp/guid_helper.hpp"
+#include "rmw_connext_shared_cpp/types.hpp"
+
+#include "test_helpers.hpp"
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+struct Options
+{
+  size_t endpoints = 10000;
+  size_t participants = 1000;
+  size_t topics = 1000;
+  size_t threads = 4;
+  size_t queries = 1000;
+};
+
+struct Endpoint
+{
+  DDS::GUID_t participant_guid;
+  DDS::GUID_t guid;
+  std::string topic_name;
+  std::string type_name;
+  EntityType entity_type;
+};
+
+/// Latencies of one kind of operation, in nanoseconds.
+class LatencyRecorder
+{
+public:
+  template<typename Function>
+  void measure(Function function)
+  {
+    auto start = Clock::now();
+    function();
+    samples_.push_back(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+  }
+
+  void merge(const LatencyRecorder & other)
+  {
+    samples_.insert(samples_.end(), other.samples_.begin(), other.samples_.end());
+  }
+
+  /// Print the throughput over the wall clock time of the phase and the latency percentiles.
+  void report(const char * operation, Clock::duration elapsed)
+  {
+    if (samples_.empty()) {
+      return;
+    }
+    std::sort(samples_.begin(), samples_.end());
+    double seconds = std::chrono::duration<double>(elapsed).count();
+    printf(
+      "%-34s %10zu %12.0f %10.2f %10.2f %10.2f %10.2f\n",
+      operation, samples_.size(), samples_.size() / seconds,
+      percentile(0.5), percentile(0.99), percentile(0.999),
+      samples_.back() / 1000.0);
+  }
+
+private:
+  /// \return the latency at the given quantile, in microseconds.
+  double percentile(double quantile) const
+  {
+    size_t index = static_cast<size_t>(quantile * (samples_.size() - 1));
+    return samples_[index] / 1000.0;
+  }
+
+  std::vector<int64_t> samples_;
+};
+
+DDS::GUID_t
+make_guid(uint64_t id, uint8_t entity_kind)
+{
+  DDS::GUID_t guid;
+  memset(&guid, 0, sizeof(guid));
+  memcpy(guid.value, &id, sizeof(id));
+  guid.value[15] = entity_kind;
+  return guid;
+}
+
+/// Build the endpoints, one in ten being half of a service.
+std::vector<Endpoint>
+make_endpoints(const Options & options)
+{
+  std::vector<Endpoint> endpoints;
+  endpoints.reserve(options.endpoints);
+  for (size_t i = 0; i < options.endpoints; ++i) {
+    Endpoint endpoint;
+    endpoint.participant_guid = make_guid(i % options.participants, 0xc1);
+    endpoint.guid = make_guid(i, 0x02);
+    std::string index = std::to_string(i % options.topics);
+    endpoint.entity_type = i % 2 ? EntityType::Publisher : EntityType::Subscriber;
+    if (i % 10 == 0) {
+      bool request = endpoint.entity_type == EntityType::Publisher;
+      endpoint.topic_name = std::string(request ? "rq" : "rr") + "/service_" + index +
+        (request ? "Request" : "Reply");
+      endpoint.type_name = "benchmark::srv::dds_::Service" + index +
+        (request ? "_Request_" : "_Response_");
+    } else {
+      endpoint.topic_name = "rt/topic_" + index;
+      endpoint.type_name = "benchmark::msg::dds_::Message" + index + "_";
+    }
+    endpoints.push_back(endpoint);
+  }
+  return endpoints;
+}
+
+Options
+parse_options(int argc, char ** argv)
+{
+  Options options;
+  parse_flags(
+    argc, argv, {
+      {"--endpoints", &options.endpoints},
+      {"--participants", &options.participants},
+      {"--topics", &options.topics},
+      {"--threads", &options.threads},
+      {"--queries", &options.queries},
+    });
+  options.participants = std::max<size_t>(options.participants, 1);
+  options.topics = std::max<size_t>(options.topics, 1);
+  options.threads = std::max<size_t>(options.threads, 1);
+  return options;
+}
+
+/// \return the peak resident set size of the process in kilobytes, 0 if unknown.
+long
+peak_rss_kb()
+{
+#ifndef _WIN32
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+# ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+# else
+    return usage.ru_maxrss;
+# endif
+  }
+#endif
+  return 0;
+}
+
+/// Run `function(thread_index)` on every thread and return the wall clock time it took.
+template<typename Function>
+Clock::duration
+run_threads(size_t thread_count, Function function)
+{
+  std::vector<std::thread> threads;
+  auto start = Clock::now();
+  for (size_t i = 0; i < thread_count; ++i) {
+    threads.emplace_back(function, i);
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  return Clock::now() - start;
+}
+
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  const Options options = parse_options(argc, argv);
+  const std::vector<Endpoint> endpoints = make_endpoints(options);
+
+  // stand-in for the graph guard condition, never triggered by the benchmark
+  rmw_guard_condition_t graph_guard_condition;
+  graph_guard_condition.implementation_identifier = "benchmark_discovery";
+  graph_guard_condition.data = nullptr;
+  CustomDataReaderListener publisher_listener(
+    graph_guard_condition.implementation_identifier, &graph_guard_condition);
+  CustomDataReaderListener subscriber_listener(
+    graph_guard_condition.implementation_identifier, &graph_guard_condition);
+  auto listener_for = [&](const Endpoint & endpoint) -> CustomDataReaderListener & {
+      return endpoint.entity_type == EntityType::Publisher ?
+             publisher_listener : subscriber_listener;
+    };
+  auto add = [&](const Endpoint & endpoint) {
+      rmw_qos_profile_t qos_profile;
+      memset(&qos_profile, 0, sizeof(qos_profile));
+      listener_for(endpoint).add_information(
+        endpoint.participant_guid, endpoint.guid, endpoint.topic_name, endpoint.type_name,
+        qos_profile, endpoint.entity_type);
+    };
+  auto remove = [&](const Endpoint & endpoint) {
+      listener_for(endpoint).remove_information(endpoint.guid, endpoint.entity_type);
+    };
+  // endpoints [begin, end) handled by a thread
+  auto slice = [&](size_t thread_index, size_t & begin, size_t & end) {
+      begin = endpoints.size() * thread_index / options.threads;
+      end = endpoints.size() * (thread_index + 1) / options.threads;
+    };
+
+  printf(
+    "%zu endpoints, %zu participants, %zu topics, %zu threads, %zu queries per thread\n\n",
+    options.endpoints, options.participants, options.topics, options.threads, options.queries);
+  printf(
+    "%-34s %10s %12s %10s %10s %10s %10s\n",
+    "operation", "count", "ops/s", "p50 us", "p99 us", "p99.9 us", "max us");
+
+  // Phase 1: concurrent discovery of every endpoint
+  std::vector<LatencyRecorder> add_recorders(options.threads);
+  auto elapsed = run_threads(
+    options.threads, [&](size_t thread_index) {
+      size_t begin, end;
+      slice(thread_index, begin, end);
+      for (size_t i = begin; i < end; ++i) {
+        add_recorders[thread_index].measure([&] {add(endpoints[i]);});
+      }
+    });
+  LatencyRecorder add_latency;
+  for (const auto & recorder : add_recorders) {
+    add_latency.merge(recorder);
+  }
+  add_latency.report("add_information", elapsed);
+  long rss_after_add = peak_rss_kb();
+
+  // Phase 2: graph queries while one thread keeps adding and removing endpoints
+  enum Query {TopicNamesAndTypes, ServiceNamesAndTypes, TopicEndpointInfos, CountTopic,
+    TopicNamesAndTypesByGuid, QueryCount};
+  const char * query_names[QueryCount] = {
+    "fill_topic_names_and_types", "fill_service_names_and_types",
+    "fill_topic_endpoint_infos", "count_topic", "fill_topic_names_and_types_by_guid"};
+  std::vector<std::vector<LatencyRecorder>> query_recorders(
+    options.threads, std::vector<LatencyRecorder>(QueryCount));
+  LatencyRecorder churn_latency;
+  std::atomic<size_t> running_queriers(options.threads);
+  elapsed = run_threads(
+    options.threads + 1, [&](size_t thread_index) {
+      if (thread_index == options.threads) {
+        // churn the first percent of the endpoints until every querier is done
+        size_t churned = std::max<size_t>(endpoints.size() / 100, 1);
+        for (size_t i = 0; running_queriers.load() > 0; i = (i + 1) % churned) {
+          churn_latency.measure([&] {remove(endpoints[i]);});
+          churn_latency.measure([&] {add(endpoints[i]);});
+        }
+        return;
+      }
+      auto & recorders = query_recorders[thread_index];
+      for (size_t i = 0; i < options.queries; ++i) {
+        size_t query = i % QueryCount;
+        std::string topic = "/topic_" + std::to_string((i * 7919 + thread_index) % options.topics);
+        DDS::GUID_t participant_guid = make_guid(i % options.participants, 0xc1);
+        recorders[query].measure(
+          [&] {
+            std::map<std::string, std::set<std::string>> names_and_types;
+            std::vector<DDSTopicEndpointInfo> infos;
+            switch (query) {
+              case TopicNamesAndTypes:
+                publisher_listener.fill_topic_names_and_types(false, names_and_types);
+                subscriber_listener.fill_topic_names_and_types(false, names_and_types);
+                break;
+              case ServiceNamesAndTypes:
+                publisher_listener.fill_service_names_and_types(names_and_types);
+                subscriber_listener.fill_service_names_and_types(names_and_types);
+                break;
+              case TopicEndpointInfos:
+                publisher_listener.fill_topic_endpoint_infos(topic, false, infos);
+                break;
+              case CountTopic:
+                subscriber_listener.count_topic(topic);
+                break;
+              case TopicNamesAndTypesByGuid:
+                publisher_listener.fill_topic_names_and_types_by_guid(
+                  false, names_and_types, participant_guid);
+                break;
+            }
+          });
+      }
+      --running_queriers;
+    });
+  for (size_t query = 0; query < QueryCount; ++query) {
+    LatencyRecorder query_latency;
+    for (const auto & recorders : query_recorders) {
+      query_latency.merge(recorders[query]);
+    }
+    query_latency.report(query_names[query], elapsed);
+  }
+  churn_latency.report("add/remove under queries", elapsed);
+
+  // Phase 3: concurrent removal of every endpoint
+  std::vector<LatencyRecorder> remove_recorders(options.threads);
+  elapsed = run_threads(
+    options.threads, [&](size_t thread_index) {
+      size_t begin, end;
+      slice(thread_index, begin, end);
+      for (size_t i = begin; i < end; ++i) {
+        remove_recorders[thread_index].measure([&] {remove(endpoints[i]);});
+      }
+    });
+  LatencyRecorder remove_latency;
+  for (const auto & recorder : remove_recorders) {
+    remove_latency.merge(recorder);
+  }
+  remove_latency.report("remove_information", elapsed);
+
+  printf("\npeak RSS after discovery: %ld kB, at exit: %ld kB\n", rss_after_add, peak_rss_kb());
+  return EXIT_SUCCESS;
+}
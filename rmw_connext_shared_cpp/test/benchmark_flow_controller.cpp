@@ -0,0 +1,276 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Latency of a small control topic while large samples are sent by the same participant,
+// with the large data writer on the default flow controller and on a token bucket flow
+// controller defined in RMW_CONNEXT_FLOW_CONTROLLERS_ENV_VAR, selected the way
+// rmw_create_publisher() applies the flow controller publisher option.
+//
+//   benchmark_flow_controller [--seconds S] [--large-size BYTES] [--rate BYTES_PER_SECOND]
+//     [--domain ID]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rmw/error_handling.h"
+#include "rmw/qos_profiles.h"
+
+#include "rmw_connext_shared_cpp/flow_controllers.hpp"
+#include "rmw_connext_shared_cpp/qos.hpp"
+#include "rmw_connext_shared_cpp/sample_size.hpp"
+
+#include "test_helpers.hpp"
+
+namespace
+{
+
+const char * const benchmark_identifier = "benchmark_flow_controller";
+const char * const flow_controller_name = "large_data";
+
+struct Options
+{
+  size_t seconds = 10;
+  size_t large_size = 10 * 1024 * 1024;
+  size_t rate = 50 * 1024 * 1024;
+  size_t domain = 42;
+};
+
+struct Result
+{
+  std::vector<double> latencies_us;
+  size_t large_samples;
+};
+
+Options
+parse_options(int argc, char ** argv)
+{
+  Options options;
+  parse_flags(
+    argc, argv, {
+      {"--seconds", &options.seconds},
+      {"--large-size", &options.large_size},
+      {"--rate", &options.rate},
+      {"--domain", &options.domain},
+    });
+  return options;
+}
+
+void
+set_flow_controllers(const Options & options)
+{
+  // refill the bucket every 10 milliseconds
+  std::string value = std::string(flow_controller_name) + ":" +
+    std::to_string(options.rate / 100) + ":10";
+#ifdef _WIN32
+  _putenv_s(RMW_CONNEXT_FLOW_CONTROLLERS_ENV_VAR, value.c_str());
+#else
+  setenv(RMW_CONNEXT_FLOW_CONTROLLERS_ENV_VAR, value.c_str(), 1);
+#endif
+}
+
+rmw_qos_profile_t
+get_qos_profile()
+{
+  rmw_qos_profile_t qos_profile = rmw_qos_profile_default;
+  qos_profile.depth = 1;
+  return qos_profile;
+}
+
+/// Create a data writer with the qos a publisher gets from the rmw and its publisher options.
+DDSOctetsDataWriter *
+create_writer(
+  DDS::DomainParticipant * participant, DDS::Topic * topic, size_t max_size,
+  const char * flow_controller)
+{
+  DDS::DataWriterQos writer_qos;
+  if (!get_datawriter_qos(
+      participant, get_qos_profile(), topic->get_name(),
+      get_pool_buffer_max_size(0, max_size), writer_qos))
+  {
+    fprintf(stderr, "failed to get the data writer qos: %s\n", rmw_get_error_string().str);
+    return nullptr;
+  }
+  DDS::PropertyQosPolicyHelper::add_property(
+    writer_qos.property, "dds.builtin_type.octets.max_size", std::to_string(max_size).c_str(),
+    DDS::BOOLEAN_FALSE);
+  if (flow_controller && !set_flow_controller_qos(flow_controller, writer_qos)) {
+    fprintf(stderr, "failed to set the flow controller: %s\n", rmw_get_error_string().str);
+    return nullptr;
+  }
+  return DDSOctetsDataWriter::narrow(
+    participant->create_datawriter(topic, writer_qos, nullptr, DDS_STATUS_MASK_NONE));
+}
+
+DDSOctetsDataReader *
+create_reader(DDS::DomainParticipant * participant, DDS::Topic * topic, size_t max_size)
+{
+  DDS::DataReaderQos reader_qos;
+  if (!get_datareader_qos(
+      participant, get_qos_profile(), topic->get_name(),
+      get_pool_buffer_max_size(0, max_size), 0, reader_qos))
+  {
+    fprintf(stderr, "failed to get the data reader qos: %s\n", rmw_get_error_string().str);
+    return nullptr;
+  }
+  DDS::PropertyQosPolicyHelper::add_property(
+    reader_qos.property, "dds.builtin_type.octets.max_size", std::to_string(max_size).c_str(),
+    DDS::BOOLEAN_FALSE);
+  return DDSOctetsDataReader::narrow(
+    participant->create_datareader(topic, reader_qos, nullptr, DDS_STATUS_MASK_NONE));
+}
+
+int64_t
+now_ns()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/// Send control samples every millisecond while large samples are sent as fast as possible.
+bool
+run(
+  DDS::DomainParticipant * sender, DDS::DomainParticipant * receiver, const Options & options,
+  const char * flow_controller, Result & result)
+{
+  DDS::Topic * large_sender_topic = create_octets_topic(sender, "benchmark_large");
+  DDS::Topic * large_receiver_topic = create_octets_topic(receiver, "benchmark_large");
+  DDS::Topic * control_sender_topic = create_octets_topic(sender, "benchmark_control");
+  DDS::Topic * control_receiver_topic = create_octets_topic(receiver, "benchmark_control");
+  if (!large_sender_topic || !large_receiver_topic || !control_sender_topic ||
+    !control_receiver_topic)
+  {
+    fprintf(stderr, "failed to create the topics\n");
+    return false;
+  }
+  DDSOctetsDataWriter * large_writer = create_writer(
+    sender, large_sender_topic, options.large_size, flow_controller);
+  DDSOctetsDataReader * large_reader = create_reader(
+    receiver, large_receiver_topic, options.large_size);
+  DDSOctetsDataWriter * control_writer = create_writer(
+    sender, control_sender_topic, sizeof(int64_t), nullptr);
+  DDSOctetsDataReader * control_reader = create_reader(
+    receiver, control_receiver_topic, sizeof(int64_t));
+  if (!large_writer || !large_reader || !control_writer || !control_reader) {
+    fprintf(stderr, "failed to create the data writers and readers\n");
+    return false;
+  }
+  if (!wait_for_matched_readers(large_writer) || !wait_for_matched_readers(control_writer)) {
+    fprintf(stderr, "the data writers and readers did not match\n");
+    return false;
+  }
+
+  std::atomic<bool> done(false);
+  result.large_samples = 0;
+  result.latencies_us.clear();
+  std::thread large_thread([&]() {
+      std::vector<unsigned char> payload(options.large_size, 0x2a);
+      while (!done) {
+        large_writer->write(payload.data(), static_cast<int>(payload.size()), DDS_HANDLE_NIL);
+      }
+    });
+  std::thread receiving_thread([&]() {
+      DDS_OctetsSeq data_seq;
+      DDS::SampleInfoSeq info_seq;
+      while (!done) {
+        bool idle = true;
+        if (control_reader->take(
+            data_seq, info_seq, DDS_LENGTH_UNLIMITED, DDS_ANY_SAMPLE_STATE,
+            DDS_ANY_VIEW_STATE, DDS_ANY_INSTANCE_STATE) == DDS_RETCODE_OK)
+        {
+          int64_t received = now_ns();
+          for (int i = 0; i < data_seq.length(); ++i) {
+            int64_t sent;
+            if (info_seq[i].valid_data && data_seq[i].length == sizeof(sent)) {
+              memcpy(&sent, data_seq[i].value, sizeof(sent));
+              result.latencies_us.push_back((received - sent) / 1000.0);
+            }
+          }
+          control_reader->return_loan(data_seq, info_seq);
+          idle = false;
+        }
+        if (large_reader->take(
+            data_seq, info_seq, DDS_LENGTH_UNLIMITED, DDS_ANY_SAMPLE_STATE,
+            DDS_ANY_VIEW_STATE, DDS_ANY_INSTANCE_STATE) == DDS_RETCODE_OK)
+        {
+          result.large_samples += data_seq.length();
+          large_reader->return_loan(data_seq, info_seq);
+          idle = false;
+        }
+        if (idle) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  auto end = std::chrono::steady_clock::now() + std::chrono::seconds(options.seconds);
+  while (std::chrono::steady_clock::now() < end) {
+    int64_t sent = now_ns();
+    control_writer->write(
+      reinterpret_cast<unsigned char *>(&sent), static_cast<int>(sizeof(sent)), DDS_HANDLE_NIL);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  done = true;
+  large_thread.join();
+  receiving_thread.join();
+  return true;
+}
+
+double
+percentile(std::vector<double> & values, double fraction)
+{
+  if (values.empty()) {
+    return 0.0;
+  }
+  size_t index = std::min(values.size() - 1, static_cast<size_t>(fraction * values.size()));
+  std::nth_element(values.begin(), values.begin() + index, values.end());
+  return values[index];
+}
+
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  const Options options = parse_options(argc, argv);
+  set_flow_controllers(options);
+
+  printf(
+    "control samples every ms for %zu s, large samples of %zu bytes, flow controller rate "
+    "%zu bytes/s\n\n%-16s %8s %10s %10s %10s %10s\n",
+    options.seconds, options.large_size, options.rate, "flow controller", "large", "control",
+    "p50 us", "p99 us", "max us");
+  for (const char * flow_controller : {static_cast<const char *>(nullptr), flow_controller_name}) {
+    NodePair nodes(benchmark_identifier, options.domain);
+    if (!nodes.is_valid()) {
+      fprintf(stderr, "failed to create the nodes: %s\n", rmw_get_error_string().str);
+      return EXIT_FAILURE;
+    }
+    Result result;
+    if (!run(nodes.sender(), nodes.receiver(), options, flow_controller, result)) {
+      return EXIT_FAILURE;
+    }
+    size_t control_samples = result.latencies_us.size();
+    printf(
+      "%-16s %8zu %10zu %10.0f %10.0f %10.0f\n", flow_controller ? flow_controller : "default",
+      result.large_samples, control_samples, percentile(result.latencies_us, 0.5),
+      percentile(result.latencies_us, 0.99), percentile(result.latencies_us, 1.0));
+  }
+  return EXIT_SUCCESS;
+}
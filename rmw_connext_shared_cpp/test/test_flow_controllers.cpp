@@ -0,0 +1,73 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "rmw_connext_shared_cpp/flow_controllers.hpp"
+
+TEST(FlowControllersTest, test_parse_flow_controllers)
+{
+  std::vector<FlowControllerConfig> flow_controllers;
+  ASSERT_TRUE(parse_flow_controllers("", flow_controllers));
+  EXPECT_TRUE(flow_controllers.empty());
+
+  ASSERT_TRUE(parse_flow_controllers("map:1048576:10;camera:65536:1:262144", flow_controllers));
+  ASSERT_EQ(2u, flow_controllers.size());
+  EXPECT_EQ("map", flow_controllers[0].name);
+  EXPECT_EQ(1048576u, flow_controllers[0].bytes_per_period);
+  EXPECT_EQ(10u, flow_controllers[0].period_ms);
+  // the burst defaults to a single period
+  EXPECT_EQ(1048576u, flow_controllers[0].max_burst_bytes);
+  EXPECT_EQ("camera", flow_controllers[1].name);
+  EXPECT_EQ(262144u, flow_controllers[1].max_burst_bytes);
+}
+
+TEST(FlowControllersTest, test_parse_flow_controllers_malformed)
+{
+  std::vector<FlowControllerConfig> flow_controllers;
+  EXPECT_FALSE(parse_flow_controllers("map", flow_controllers));
+  EXPECT_FALSE(parse_flow_controllers("map:1024", flow_controllers));
+  EXPECT_FALSE(parse_flow_controllers(":1024:10", flow_controllers));
+  EXPECT_FALSE(parse_flow_controllers("map:1024:0", flow_controllers));
+  EXPECT_FALSE(parse_flow_controllers("map:1k:10", flow_controllers));
+  EXPECT_FALSE(parse_flow_controllers("map:1024:10:1:1", flow_controllers));
+}
+
+TEST(FlowControllersTest, test_is_flow_controller_defined)
+{
+  EXPECT_TRUE(is_flow_controller_defined("map:1048576:10;camera:65536:1", "camera"));
+  EXPECT_FALSE(is_flow_controller_defined("map:1048576:10;camera:65536:1", "camra"));
+  EXPECT_FALSE(is_flow_controller_defined("", "map"));
+  EXPECT_FALSE(is_flow_controller_defined("map:1k:10", "map"));
+}
+
+TEST(FlowControllersTest, test_flow_controller_properties)
+{
+  FlowControllerConfig flow_controller{"map", 1000000, 1500, 4000000};
+  std::map<std::string, std::string> properties;
+  for (const auto & name_value : get_flow_controller_properties(flow_controller)) {
+    properties.insert(name_value);
+  }
+  const std::string prefix = "dds.flow_controller.token_bucket.map.token_bucket.";
+  EXPECT_EQ("977", properties[prefix + "tokens_added_per_period"]);
+  EXPECT_EQ("3907", properties[prefix + "max_tokens"]);
+  EXPECT_EQ("1024", properties[prefix + "bytes_per_token"]);
+  EXPECT_EQ("1", properties[prefix + "period.sec"]);
+  EXPECT_EQ("500000000", properties[prefix + "period.nanosec"]);
+  EXPECT_EQ("dds.flow_controller.token_bucket.map", get_flow_controller_name("map"));
+}
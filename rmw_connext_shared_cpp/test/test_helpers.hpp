@@ -0,0 +1,162 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TEST_HELPERS_HPP_
+#define TEST_HELPERS_HPP_
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <thread>
+
+#include "rmw/init.h"
+#include "rmw/rmw.h"
+
+#include "rmw_connext_shared_cpp/ndds_include.hpp"
+#include "rmw_connext_shared_cpp/node.hpp"
+#include "rmw_connext_shared_cpp/types.hpp"
+
+// Scaffolding shared by the tests and benchmarks which exchange samples between real Connext
+// entities.
+
+/// Parse `--flag value` pairs of unsigned integers, exit on an unknown flag.
+inline void
+parse_flags(int argc, char ** argv, const std::map<std::string, size_t *> & flags)
+{
+  for (int i = 1; i + 1 < argc; i += 2) {
+    auto flag = flags.find(argv[i]);
+    if (flag == flags.end()) {
+      fprintf(stderr, "unknown option '%s'\n", argv[i]);
+      exit(EXIT_FAILURE);
+    }
+    *flag->second = std::strtoull(argv[i + 1], nullptr, 10);
+  }
+}
+
+inline DDS::DomainParticipant *
+get_participant(const rmw_node_t * node)
+{
+  return static_cast<ConnextNodeInfo *>(node->data)->participant;
+}
+
+/// Create a topic of the Connext builtin octets type, registering the type if needed.
+/**
+ * \return the topic, or nullptr if the type or the topic couldn't be created
+ */
+inline DDS::Topic *
+create_octets_topic(DDS::DomainParticipant * participant, const char * topic_name)
+{
+  const char * type_name = DDSOctetsTypeSupport::get_type_name();
+  if (DDSOctetsTypeSupport::register_type(participant, type_name) != DDS::RETCODE_OK) {
+    return nullptr;
+  }
+  return participant->create_topic(
+    topic_name, type_name, DDS_TOPIC_QOS_DEFAULT, nullptr, DDS_STATUS_MASK_NONE);
+}
+
+/// Wait up to 10 seconds until a data writer matched at least `count` data readers.
+inline bool
+wait_for_matched_readers(DDS::DataWriter * writer, DDS::Long count = 1)
+{
+  DDS::PublicationMatchedStatus matched_status;
+  for (int i = 0; i < 100; ++i) {
+    if (writer->get_publication_matched_status(matched_status) == DDS::RETCODE_OK &&
+      matched_status.current_count >= count)
+    {
+      return true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+  return false;
+}
+
+/// A sender and a receiver localhost only node of the same process.
+/**
+ * The nodes are created with the environment as it is at construction and destroyed with all
+ * the entities they contain.
+ */
+class NodePair
+{
+public:
+  NodePair(const char * implementation_identifier, size_t domain_id)
+  : implementation_identifier_(implementation_identifier),
+    context_(rmw_get_zero_initialized_context()),
+    security_options_()
+  {
+    context_.implementation_identifier = implementation_identifier;
+    sender_ = create_node(
+      implementation_identifier, &context_, "sender", "/", domain_id, &security_options_, true);
+    receiver_ = create_node(
+      implementation_identifier, &context_, "receiver", "/", domain_id, &security_options_,
+      true);
+  }
+
+  NodePair(const NodePair &) = delete;
+  NodePair & operator=(const NodePair &) = delete;
+
+  ~NodePair()
+  {
+    destroy();
+  }
+
+  /// \return true if both nodes were created
+  bool
+  is_valid() const
+  {
+    return sender_ && receiver_;
+  }
+
+  DDS::DomainParticipant *
+  sender() const
+  {
+    return get_participant(sender_);
+  }
+
+  DDS::DomainParticipant *
+  receiver() const
+  {
+    return get_participant(receiver_);
+  }
+
+  /// Destroy the nodes, only the first call has an effect.
+  /**
+   * \return RMW_RET_OK if successful, or the error of the first node which failed
+   */
+  rmw_ret_t
+  destroy()
+  {
+    rmw_ret_t ret = RMW_RET_OK;
+    if (receiver_) {
+      ret = destroy_node(implementation_identifier_, receiver_);
+      receiver_ = nullptr;
+    }
+    if (sender_) {
+      rmw_ret_t sender_ret = destroy_node(implementation_identifier_, sender_);
+      ret = ret == RMW_RET_OK ? sender_ret : ret;
+      sender_ = nullptr;
+    }
+    return ret;
+  }
+
+private:
+  const char * implementation_identifier_;
+  rmw_context_t context_;
+  rmw_node_security_options_t security_options_;
+  rmw_node_t * sender_;
+  rmw_node_t * receiver_;
+};
+
+#endif  // TEST_HELPERS_HPP_
@@ -0,0 +1,76 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <limits>
+
+#include "gtest/gtest.h"
+
+#include "rmw_connext_shared_cpp/latency_histogram.hpp"
+
+TEST(LatencyHistogramTest, test_bucket_bounds)
+{
+  for (int64_t latency : {0LL, 7LL, 8LL, 15LL, 16LL, 1000LL, 123456789LL}) {
+    size_t index = LatencyHistogram::get_bucket_index(latency);
+    EXPECT_LE(latency, LatencyHistogram::get_bucket_upper_bound(index));
+    if (index > 0) {
+      EXPECT_GT(latency, LatencyHistogram::get_bucket_upper_bound(index - 1));
+    }
+  }
+  // the width of a bucket is at most an eighth of its values
+  size_t index = LatencyHistogram::get_bucket_index(1000000);
+  EXPECT_LE(
+    LatencyHistogram::get_bucket_upper_bound(index) -
+    LatencyHistogram::get_bucket_upper_bound(index - 1), 1000000 / 8);
+  EXPECT_EQ(
+    LatencyHistogram::bucket_count - 1,
+    LatencyHistogram::get_bucket_index((std::numeric_limits<int64_t>::max)()));
+}
+
+TEST(LatencyHistogramTest, test_percentiles)
+{
+  LatencyHistogram histogram;
+  EXPECT_EQ(0u, histogram.get_count());
+  EXPECT_EQ(0, histogram.get_percentile(50.0));
+  EXPECT_EQ(0, histogram.get_min());
+
+  // 1 us to 100 us
+  for (int64_t i = 1; i <= 100; ++i) {
+    histogram.record(i * 1000);
+  }
+  EXPECT_EQ(100u, histogram.get_count());
+  EXPECT_EQ(1000, histogram.get_min());
+  EXPECT_EQ(100000, histogram.get_max());
+  int64_t median = histogram.get_percentile(50.0);
+  EXPECT_GE(median, 50000);
+  EXPECT_LE(median, 50000 + 50000 / 8);
+  int64_t p99 = histogram.get_percentile(99.0);
+  EXPECT_GE(p99, 99000);
+  EXPECT_LE(p99, 100000);
+  EXPECT_EQ(100000, histogram.get_percentile(100.0));
+
+  histogram.reset();
+  EXPECT_EQ(0u, histogram.get_count());
+  EXPECT_EQ(0, histogram.get_max());
+}
+
+TEST(LatencyHistogramTest, test_negative_latency)
+{
+  LatencyHistogram histogram;
+  histogram.record(-500);
+  EXPECT_EQ(1u, histogram.get_count());
+  EXPECT_EQ(1u, histogram.get_negative_count());
+  EXPECT_EQ(0, histogram.get_min());
+  EXPECT_EQ(0, histogram.get_percentile(50.0));
+}
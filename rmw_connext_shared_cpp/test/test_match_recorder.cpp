@@ -0,0 +1,85 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+#include "rmw_connext_shared_cpp/match_recorder.hpp"
+#include "rmw_connext_shared_cpp/types.hpp"
+
+static const char * const identifier = "test_identifier";
+
+static DDS::InstanceHandle_t
+make_handle(DDS::Octet id)
+{
+  DDS::InstanceHandle_t handle;
+  memset(&handle, 0, sizeof(handle));
+  reinterpret_cast<DDS::Octet *>(&handle)[15] = id;
+  return handle;
+}
+
+TEST(MatchRecorderTest, test_time_to_first_match)
+{
+  const auto creation = MatchRecorder::Clock::now();
+  MatchRecorder recorder(identifier, creation);
+  MatchMetrics metrics;
+  recorder.get_metrics(metrics);
+  EXPECT_FALSE(metrics.has_matched);
+  EXPECT_TRUE(metrics.history.empty());
+
+  // an unmatch before any match doesn't count as the first match
+  EXPECT_FALSE(recorder.record(false, make_handle(1), 0, creation + std::chrono::seconds(1)));
+  EXPECT_TRUE(recorder.record(true, make_handle(2), 1, creation + std::chrono::seconds(2)));
+  EXPECT_FALSE(recorder.record(true, make_handle(3), 2, creation + std::chrono::seconds(3)));
+  EXPECT_FALSE(recorder.record(false, make_handle(2), 1, creation + std::chrono::seconds(4)));
+  EXPECT_FALSE(recorder.record(true, make_handle(2), 2, creation + std::chrono::seconds(5)));
+
+  recorder.get_metrics(metrics);
+  EXPECT_TRUE(metrics.has_matched);
+  EXPECT_EQ(std::chrono::seconds(2), metrics.time_to_first_match);
+  ASSERT_EQ(5u, metrics.history.size());
+  const MatchEvent & event = metrics.history[2];
+  EXPECT_EQ(std::chrono::seconds(3), event.time_since_creation);
+  EXPECT_TRUE(event.matched);
+  EXPECT_EQ(2u, event.current_count);
+  EXPECT_EQ(identifier, event.peer_gid.implementation_identifier);
+  const DDS::InstanceHandle_t handle = make_handle(3);
+  auto peer_gid = reinterpret_cast<const ConnextPublisherGID *>(event.peer_gid.data);
+  EXPECT_EQ(0, memcmp(&handle, &peer_gid->publication_handle, sizeof(handle)));
+  EXPECT_FALSE(metrics.history[3].matched);
+  EXPECT_EQ(1u, metrics.history[3].current_count);
+}
+
+TEST(MatchRecorderTest, test_history_is_bounded)
+{
+  const auto creation = MatchRecorder::Clock::now();
+  MatchRecorder recorder(identifier, creation);
+  const size_t event_count = MatchRecorder::max_history + 10;
+  for (size_t i = 0; i < event_count; ++i) {
+    recorder.record(
+      i % 2 == 0, make_handle(1), (i + 1) % 2, creation + std::chrono::milliseconds(i));
+  }
+
+  MatchMetrics metrics;
+  recorder.get_metrics(metrics);
+  ASSERT_EQ(MatchRecorder::max_history, metrics.history.size());
+  // the oldest events were dropped, the first match is still known
+  EXPECT_EQ(std::chrono::milliseconds(10), metrics.history.front().time_since_creation);
+  EXPECT_EQ(
+    std::chrono::milliseconds(event_count - 1), metrics.history.back().time_since_creation);
+  EXPECT_TRUE(metrics.has_matched);
+  EXPECT_EQ(std::chrono::milliseconds(0), metrics.time_to_first_match);
+}
@@ -0,0 +1,56 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <map>
+#include <set>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "rmw_connext_shared_cpp/names_and_types_cache.hpp"
+
+using NamesAndTypes = NamesAndTypesCache::NamesAndTypes;
+
+TEST(NamesAndTypesCacheTest, test_names_and_types_cache_reuse)
+{
+  NamesAndTypesCache cache;
+  int fill_count = 0;
+  auto fill = [&fill_count](NamesAndTypes & names_and_types) {
+      ++fill_count;
+      names_and_types["topic" + std::to_string(fill_count)].insert("type");
+    };
+
+  auto first = cache.get(DemangledTopics, 0, 0, fill);
+  EXPECT_EQ(1, fill_count);
+  EXPECT_EQ(1u, first->count("topic1"));
+
+  // unchanged generations reuse the memoized result
+  auto second = cache.get(DemangledTopics, 0, 0, fill);
+  EXPECT_EQ(1, fill_count);
+  EXPECT_EQ(first, second);
+
+  // each kind is memoized separately
+  cache.get(RawTopics, 0, 0, fill);
+  EXPECT_EQ(2, fill_count);
+
+  // a change on either side recomputes
+  auto third = cache.get(DemangledTopics, 1, 0, fill);
+  EXPECT_EQ(3, fill_count);
+  EXPECT_EQ(1u, third->count("topic3"));
+  cache.get(DemangledTopics, 1, 1, fill);
+  EXPECT_EQ(4, fill_count);
+
+  // previously returned results stay valid
+  EXPECT_EQ(1u, first->count("topic1"));
+}
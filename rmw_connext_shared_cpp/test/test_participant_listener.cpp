@@ -0,0 +1,99 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "rmw_connext_shared_cpp/types.hpp"
+
+class ParticipantListenerTestFixture : public ::testing::Test
+{
+public:
+  CustomParticipantListener participant_listener{nullptr, nullptr};
+  DDS::GUID_t participant_guid[3];
+
+  void SetUp()
+  {
+    for (int i = 0; i < 3; ++i) {
+      memset(&participant_guid[i], i + 1, sizeof(DDS::GUID_t));
+    }
+    participant_listener.add_information(participant_guid[0], "node1", "/");
+    participant_listener.add_information(participant_guid[1], "node2", "/ns");
+  }
+};
+
+TEST_F(ParticipantListenerTestFixture, test_participant_listener_get_participant_name)
+{
+  ParticipantNameInfo name_info;
+  ASSERT_TRUE(participant_listener.get_participant_name(participant_guid[1], name_info));
+  EXPECT_EQ("node2", name_info.name);
+  EXPECT_EQ("/ns", name_info.namespace_);
+
+  EXPECT_FALSE(participant_listener.get_participant_name(participant_guid[2], name_info));
+}
+
+TEST_F(ParticipantListenerTestFixture, test_participant_listener_get_participant_guid)
+{
+  DDS::GUID_t guid;
+  ASSERT_TRUE(participant_listener.get_participant_guid("node1", "/", guid));
+  EXPECT_EQ(participant_guid[0], guid);
+  ASSERT_TRUE(participant_listener.get_participant_guid("node2", "/ns", guid));
+  EXPECT_EQ(participant_guid[1], guid);
+
+  EXPECT_FALSE(participant_listener.get_participant_guid("node2", "/", guid));
+  EXPECT_FALSE(participant_listener.get_participant_guid("node3", "/", guid));
+}
+
+TEST_F(ParticipantListenerTestFixture, test_participant_listener_add_remove)
+{
+  // adding the same information twice is not a change
+  EXPECT_FALSE(participant_listener.add_information(participant_guid[0], "node1", "/"));
+  // renaming a participant is a change
+  EXPECT_TRUE(participant_listener.add_information(participant_guid[0], "node3", "/"));
+  DDS::GUID_t guid;
+  EXPECT_FALSE(participant_listener.get_participant_guid("node1", "/", guid));
+  ASSERT_TRUE(participant_listener.get_participant_guid("node3", "/", guid));
+  EXPECT_EQ(participant_guid[0], guid);
+
+  EXPECT_TRUE(participant_listener.remove_information(participant_guid[0]));
+  EXPECT_FALSE(participant_listener.remove_information(participant_guid[0]));
+  EXPECT_FALSE(participant_listener.get_participant_guid("node3", "/", guid));
+}
+
+TEST_F(ParticipantListenerTestFixture, test_participant_listener_fill_node_names)
+{
+  std::vector<ParticipantNameInfo> node_names;
+  participant_listener.fill_node_names(node_names);
+  ASSERT_EQ(2u, node_names.size());
+  bool found_node1 = false;
+  bool found_node2 = false;
+  for (const auto & name_info : node_names) {
+    found_node1 |= name_info.name == "node1" && name_info.namespace_ == "/";
+    found_node2 |= name_info.name == "node2" && name_info.namespace_ == "/ns";
+  }
+  EXPECT_TRUE(found_node1);
+  EXPECT_TRUE(found_node2);
+}
+
+TEST_F(ParticipantListenerTestFixture, test_participant_listener_duplicate_node_name)
+{
+  // another participant announcing the same node name
+  EXPECT_TRUE(participant_listener.add_information(participant_guid[2], "node1", "/"));
+  EXPECT_TRUE(participant_listener.remove_information(participant_guid[0]));
+  DDS::GUID_t guid;
+  ASSERT_TRUE(participant_listener.get_participant_guid("node1", "/", guid));
+  EXPECT_EQ(participant_guid[2], guid);
+}
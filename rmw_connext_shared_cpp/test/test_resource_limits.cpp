@@ -0,0 +1,164 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdlib>
+
+#include "gtest/gtest.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/qos_profiles.h"
+
+#include "rmw_connext_shared_cpp/qos.hpp"
+#include "rmw_connext_shared_cpp/resource_limits.hpp"
+#include "rmw_connext_shared_cpp/sample_size.hpp"
+
+#include "test_helpers.hpp"
+
+TEST(ResourceLimitsTest, test_preallocated_resource_limits_keep_last)
+{
+  DDS::HistoryQosPolicy history;
+  history.kind = DDS::KEEP_LAST_HISTORY_QOS;
+  history.depth = 10;
+  DDS::ResourceLimitsQosPolicy resource_limits;
+  resource_limits.max_samples = DDS::LENGTH_UNLIMITED;
+  resource_limits.max_instances = DDS::LENGTH_UNLIMITED;
+  resource_limits.max_samples_per_instance = DDS::LENGTH_UNLIMITED;
+  resource_limits.initial_samples = 1;
+  resource_limits.initial_instances = 1;
+
+  ASSERT_TRUE(set_preallocated_resource_limits(history, resource_limits));
+  EXPECT_EQ(10, resource_limits.max_samples_per_instance);
+  EXPECT_EQ(1, resource_limits.max_instances);
+  // with everything allocated up front a sustained load cannot grow the pools any further
+  EXPECT_EQ(resource_limits.max_samples, resource_limits.initial_samples);
+  EXPECT_EQ(resource_limits.max_instances, resource_limits.initial_instances);
+  EXPECT_GE(
+    resource_limits.max_samples,
+    resource_limits.max_samples_per_instance * resource_limits.max_instances);
+}
+
+TEST(ResourceLimitsTest, test_preallocated_resource_limits_keep_all)
+{
+  DDS::HistoryQosPolicy history;
+  history.kind = DDS::KEEP_ALL_HISTORY_QOS;
+  history.depth = 10;
+  DDS::ResourceLimitsQosPolicy resource_limits;
+  resource_limits.max_samples = DDS::LENGTH_UNLIMITED;
+  resource_limits.max_instances = DDS::LENGTH_UNLIMITED;
+  resource_limits.max_samples_per_instance = DDS::LENGTH_UNLIMITED;
+  resource_limits.initial_samples = 1;
+  resource_limits.initial_instances = 1;
+
+  EXPECT_FALSE(set_preallocated_resource_limits(history, resource_limits));
+  EXPECT_EQ(DDS::LENGTH_UNLIMITED, resource_limits.max_samples);
+  EXPECT_EQ(1, resource_limits.initial_samples);
+}
+
+TEST(ResourceLimitsTest, test_bounded_fragmented_samples)
+{
+  DDS::HistoryQosPolicy history;
+  history.kind = DDS::KEEP_LAST_HISTORY_QOS;
+  history.depth = 5;
+  DDS::DataReaderResourceLimitsQosPolicy reader_resource_limits;
+  reader_resource_limits.max_fragmented_samples = 1024;
+  reader_resource_limits.initial_fragmented_samples = 4;
+  reader_resource_limits.max_fragmented_samples_per_remote_writer = 256;
+
+  ASSERT_TRUE(set_bounded_fragmented_samples(history, reader_resource_limits));
+  EXPECT_EQ(5, reader_resource_limits.max_fragmented_samples);
+  EXPECT_EQ(5, reader_resource_limits.initial_fragmented_samples);
+  EXPECT_EQ(5, reader_resource_limits.max_fragmented_samples_per_remote_writer);
+
+  history.kind = DDS::KEEP_ALL_HISTORY_QOS;
+  reader_resource_limits.max_fragmented_samples = 1024;
+  EXPECT_FALSE(set_bounded_fragmented_samples(history, reader_resource_limits));
+  EXPECT_EQ(1024, reader_resource_limits.max_fragmented_samples);
+}
+
+// The qos of the rmw endpoints with RMW_CONNEXT_PREALLOCATE_SAMPLES set, as Connext applies it.
+TEST(ResourceLimitsTest, test_preallocated_endpoints)
+{
+#ifdef _WIN32
+  _putenv_s(RMW_CONNEXT_PREALLOCATE_SAMPLES_ENV_VAR, "1");
+#else
+  setenv(RMW_CONNEXT_PREALLOCATE_SAMPLES_ENV_VAR, "1", 1);
+#endif
+  ASSERT_TRUE(load_qos_settings()) << rmw_get_error_string().str;
+  NodePair nodes("test_resource_limits", 42);
+  ASSERT_TRUE(nodes.is_valid()) << rmw_get_error_string().str;
+  DDS::DomainParticipant * participant = nodes.sender();
+  DDS::Topic * topic = create_octets_topic(participant, "test_resource_limits");
+  ASSERT_NE(nullptr, topic);
+  DDS::DataWriterQos default_writer_qos;
+  DDS::DataReaderQos default_reader_qos;
+  ASSERT_EQ(DDS::RETCODE_OK, participant->get_default_datawriter_qos(default_writer_qos));
+  ASSERT_EQ(DDS::RETCODE_OK, participant->get_default_datareader_qos(default_reader_qos));
+
+  rmw_qos_profile_t keep_last = rmw_qos_profile_default;
+  keep_last.depth = 5;
+  rmw_qos_profile_t keep_all = rmw_qos_profile_default;
+  keep_all.history = RMW_QOS_POLICY_HISTORY_KEEP_ALL;
+  size_t pool_buffer_max_size = get_pool_buffer_max_size(0, 64);
+  for (const rmw_qos_profile_t & qos_profile : {keep_last, keep_all}) {
+    DDS::DataWriterQos writer_qos;
+    DDS::DataReaderQos reader_qos;
+    ASSERT_TRUE(
+      get_datawriter_qos(
+        participant, qos_profile, "test_resource_limits", pool_buffer_max_size, writer_qos)) <<
+      rmw_get_error_string().str;
+    ASSERT_TRUE(
+      get_datareader_qos(
+        participant, qos_profile, "test_resource_limits", pool_buffer_max_size, 0, reader_qos)) <<
+      rmw_get_error_string().str;
+    DDS::DataWriter * writer = participant->create_datawriter(
+      topic, writer_qos, nullptr, DDS_STATUS_MASK_NONE);
+    DDS::DataReader * reader = participant->create_datareader(
+      topic, reader_qos, nullptr, DDS_STATUS_MASK_NONE);
+    ASSERT_NE(nullptr, writer);
+    ASSERT_NE(nullptr, reader);
+    ASSERT_EQ(DDS::RETCODE_OK, writer->get_qos(writer_qos));
+    ASSERT_EQ(DDS::RETCODE_OK, reader->get_qos(reader_qos));
+
+    if (qos_profile.history == RMW_QOS_POLICY_HISTORY_KEEP_LAST) {
+      EXPECT_EQ(DDS::KEEP_LAST_HISTORY_QOS, writer_qos.history.kind);
+      EXPECT_EQ(5, writer_qos.history.depth);
+      EXPECT_EQ(DDS::KEEP_LAST_HISTORY_QOS, reader_qos.history.kind);
+      EXPECT_EQ(5, reader_qos.history.depth);
+      for (const DDS::ResourceLimitsQosPolicy & resource_limits :
+        {writer_qos.resource_limits, reader_qos.resource_limits})
+      {
+        EXPECT_EQ(5, resource_limits.max_samples);
+        EXPECT_EQ(5, resource_limits.initial_samples);
+        EXPECT_EQ(5, resource_limits.max_samples_per_instance);
+        EXPECT_EQ(1, resource_limits.max_instances);
+        EXPECT_EQ(1, resource_limits.initial_instances);
+      }
+    } else {
+      // keep all histories keep growing on demand
+      EXPECT_EQ(DDS::KEEP_ALL_HISTORY_QOS, writer_qos.history.kind);
+      EXPECT_EQ(
+        default_writer_qos.resource_limits.max_samples, writer_qos.resource_limits.max_samples);
+      EXPECT_EQ(
+        default_writer_qos.resource_limits.initial_samples,
+        writer_qos.resource_limits.initial_samples);
+      EXPECT_EQ(DDS::KEEP_ALL_HISTORY_QOS, reader_qos.history.kind);
+      EXPECT_EQ(
+        default_reader_qos.resource_limits.max_samples, reader_qos.resource_limits.max_samples);
+      EXPECT_EQ(
+        default_reader_qos.resource_limits.initial_samples,
+        reader_qos.resource_limits.initial_samples);
+    }
+  }
+  EXPECT_EQ(RMW_RET_OK, nodes.destroy());
+}
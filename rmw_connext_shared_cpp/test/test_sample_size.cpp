@@ -0,0 +1,105 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+
+#include "rmw_connext_shared_cpp/sample_size.hpp"
+
+class SampleSizeTestFixture : public ::testing::Test
+{
+public:
+  DDS_TypeCodeFactory * factory = DDS_TypeCodeFactory::get_instance();
+  DDS_ExceptionCode_t ex = DDS_NO_EXCEPTION_CODE;
+
+  DDS_TypeCode * create_struct(const char * name)
+  {
+    DDS_StructMemberSeq members;
+    DDS_TypeCode * type_code = factory->create_struct_tc(name, members, ex);
+    EXPECT_EQ(DDS_NO_EXCEPTION_CODE, ex);
+    return type_code;
+  }
+
+  void add_member(DDS_TypeCode * type_code, const char * name, const DDS_TypeCode * member_type)
+  {
+    type_code->add_member(
+      name, DDS_TYPECODE_MEMBER_ID_INVALID, member_type, DDS_TYPECODE_NONKEY_MEMBER, ex);
+    EXPECT_EQ(DDS_NO_EXCEPTION_CODE, ex);
+  }
+};
+
+TEST_F(SampleSizeTestFixture, test_max_serialized_size_primitives)
+{
+  DDS_TypeCode * type_code = create_struct("Primitives");
+  add_member(type_code, "a", factory->get_primitive_tc(DDS_TK_OCTET));
+  add_member(type_code, "b", factory->get_primitive_tc(DDS_TK_DOUBLE));
+  add_member(type_code, "c", factory->get_primitive_tc(DDS_TK_SHORT));
+  // encapsulation, octet, padding to 8, double, short
+  EXPECT_EQ(4u + 1u + 7u + 8u + 2u, get_max_serialized_size(type_code));
+  factory->delete_tc(type_code, ex);
+}
+
+TEST_F(SampleSizeTestFixture, test_max_serialized_size_bounded)
+{
+  DDS_TypeCode * string_tc = factory->create_string_tc(10, ex);
+  DDS_TypeCode * sequence_tc =
+    factory->create_sequence_tc(3, *factory->get_primitive_tc(DDS_TK_LONG), ex);
+  DDS_TypeCode * type_code = create_struct("Bounded");
+  add_member(type_code, "s", string_tc);
+  add_member(type_code, "v", sequence_tc);
+  // encapsulation, string length and characters, padding to 4, sequence length and elements
+  EXPECT_EQ(4u + 4u + 11u + 1u + 4u + 12u, get_max_serialized_size(type_code));
+  factory->delete_tc(type_code, ex);
+  factory->delete_tc(sequence_tc, ex);
+  factory->delete_tc(string_tc, ex);
+}
+
+TEST_F(SampleSizeTestFixture, test_max_serialized_size_unbounded)
+{
+  DDS_TypeCode * string_tc = factory->create_string_tc(0, ex);
+  DDS_TypeCode * type_code = create_struct("Unbounded");
+  add_member(type_code, "a", factory->get_primitive_tc(DDS_TK_LONG));
+  add_member(type_code, "s", string_tc);
+  EXPECT_EQ(0u, get_max_serialized_size(type_code));
+  EXPECT_EQ(0u, get_max_serialized_size(nullptr));
+  factory->delete_tc(type_code, ex);
+  factory->delete_tc(string_tc, ex);
+}
+
+TEST(SampleSizeTest, test_pool_buffer_max_size)
+{
+  // bounded types fit their largest sample
+  EXPECT_EQ(24u + 8u, get_pool_buffer_max_size(24, 0));
+  EXPECT_EQ(
+    static_cast<size_t>(RMW_CONNEXT_MAX_POOL_BUFFER_MAX_SIZE),
+    get_pool_buffer_max_size(1024 * 1024, 0));
+  // unbounded types fit the largest observed sample
+  EXPECT_EQ(
+    static_cast<size_t>(RMW_CONNEXT_DEFAULT_POOL_BUFFER_MAX_SIZE), get_pool_buffer_max_size(0, 0));
+  EXPECT_EQ(64u, get_pool_buffer_max_size(0, 20));
+  EXPECT_EQ(16384u, get_pool_buffer_max_size(0, 10000));
+  EXPECT_EQ(
+    static_cast<size_t>(RMW_CONNEXT_MAX_POOL_BUFFER_MAX_SIZE),
+    get_pool_buffer_max_size(0, 1024 * 1024));
+}
+
+TEST(SampleSizeTest, test_sample_size_record)
+{
+  SampleSizeRecord * record = get_sample_size_record("test_msgs::msg::dds_::Strings_");
+  EXPECT_EQ(record, get_sample_size_record("test_msgs::msg::dds_::Strings_"));
+  EXPECT_NE(record, get_sample_size_record("test_msgs::msg::dds_::Empty_"));
+  EXPECT_EQ(0u, record->get());
+  record->record(100);
+  record->record(50);
+  EXPECT_EQ(100u, record->get());
+}
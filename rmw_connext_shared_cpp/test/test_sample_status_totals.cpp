@@ -0,0 +1,102 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "rmw/error_handling.h"
+
+#include "rmw_connext_shared_cpp/sample_status_totals.hpp"
+
+#include "test_helpers.hpp"
+
+namespace
+{
+
+/// Create a reliable keep all data reader with room for a single sample.
+DDS::DataReader *
+create_full_reader(DDS::DomainParticipant * participant, DDS::Topic * topic)
+{
+  DDS::DataReaderQos reader_qos;
+  if (participant->get_default_datareader_qos(reader_qos) != DDS::RETCODE_OK) {
+    return nullptr;
+  }
+  reader_qos.reliability.kind = DDS::RELIABLE_RELIABILITY_QOS;
+  reader_qos.history.kind = DDS::KEEP_ALL_HISTORY_QOS;
+  reader_qos.resource_limits.max_samples = 1;
+  reader_qos.resource_limits.max_instances = 1;
+  reader_qos.resource_limits.max_samples_per_instance = 1;
+  reader_qos.resource_limits.initial_samples = 1;
+  reader_qos.resource_limits.initial_instances = 1;
+  return participant->create_datareader(topic, reader_qos, nullptr, DDS_STATUS_MASK_NONE);
+}
+
+}  // namespace
+
+// Samples sent to readers which never take them are rejected, the totals count them without
+// clearing the changed status of an attached event.
+TEST(SampleStatusTotalsTest, test_rejected_samples_are_counted)
+{
+  NodePair nodes("test_sample_status_totals", 42);
+  ASSERT_TRUE(nodes.is_valid()) << rmw_get_error_string().str;
+  DDS::Topic * sender_topic = create_octets_topic(nodes.sender(), "test_sample_status_totals");
+  DDS::Topic * receiver_topic = create_octets_topic(
+    nodes.receiver(), "test_sample_status_totals");
+  ASSERT_NE(nullptr, sender_topic);
+  ASSERT_NE(nullptr, receiver_topic);
+  DDS::DataWriter * writer = nodes.sender()->create_datawriter(
+    sender_topic, DDS_DATAWRITER_QOS_DEFAULT, nullptr, DDS_STATUS_MASK_NONE);
+  DDS::DataReader * reader = create_full_reader(nodes.receiver(), receiver_topic);
+  DDS::DataReader * event_reader = create_full_reader(nodes.receiver(), receiver_topic);
+  DDSOctetsDataWriter * octets_writer = DDSOctetsDataWriter::narrow(writer);
+  ASSERT_NE(nullptr, octets_writer);
+  ASSERT_NE(nullptr, reader);
+  ASSERT_NE(nullptr, event_reader);
+  ASSERT_TRUE(wait_for_matched_readers(writer, 2));
+
+  SampleStatusTotals totals;
+  SampleStatusTotals event_totals;
+  event_totals.attach_event(DDS_SAMPLE_REJECTED_STATUS);
+
+  unsigned char payload[8] = {};
+  for (int i = 0; i < 3; ++i) {
+    // the writer may time out waiting for the readers to make room, it doesn't matter here
+    octets_writer->write(payload, sizeof(payload), DDS_HANDLE_NIL);
+  }
+
+  uint64_t samples_lost = 0;
+  uint64_t samples_rejected = 0;
+  for (int i = 0; i < 50 && samples_rejected == 0; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(DDS::RETCODE_OK, totals.get_totals(reader, samples_lost, samples_rejected));
+  }
+  EXPECT_GT(samples_rejected, 0u);
+
+  // the totals leave the status of the attached event alone until the event reads it
+  ASSERT_EQ(
+    DDS::RETCODE_OK, event_totals.get_totals(event_reader, samples_lost, samples_rejected));
+  EXPECT_EQ(0u, samples_rejected);
+  EXPECT_NE(0u, event_reader->get_status_changes() & DDS_SAMPLE_REJECTED_STATUS);
+  DDS::SampleRejectedStatus status;
+  ASSERT_EQ(DDS::RETCODE_OK, event_totals.read_status(event_reader, status));
+  EXPECT_GT(status.total_count, 0);
+  ASSERT_EQ(
+    DDS::RETCODE_OK, event_totals.get_totals(event_reader, samples_lost, samples_rejected));
+  EXPECT_EQ(static_cast<uint64_t>(status.total_count), samples_rejected);
+
+  EXPECT_EQ(RMW_RET_OK, nodes.destroy());
+}
@@ -0,0 +1,158 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/qos_profiles.h"
+
+#include "rmw_connext_shared_cpp/qos.hpp"
+#include "rmw_connext_shared_cpp/sample_size.hpp"
+
+#include "test_helpers.hpp"
+
+namespace
+{
+
+const char * const test_identifier = "test_time_based_filter";
+
+rmw_time_t
+milliseconds(uint64_t ms)
+{
+  rmw_time_t time;
+  time.sec = ms / 1000;
+  time.nsec = (ms % 1000) * 1000000;
+  return time;
+}
+
+size_t
+take_all(DDSOctetsDataReader * reader)
+{
+  DDS_OctetsSeq data_seq;
+  DDS::SampleInfoSeq info_seq;
+  size_t taken = 0;
+  while (reader->take(
+      data_seq, info_seq, DDS_LENGTH_UNLIMITED, DDS_ANY_SAMPLE_STATE,
+      DDS_ANY_VIEW_STATE, DDS_ANY_INSTANCE_STATE) == DDS_RETCODE_OK)
+  {
+    for (int i = 0; i < data_seq.length(); ++i) {
+      if (info_seq[i].valid_data) {
+        ++taken;
+      }
+    }
+    reader->return_loan(data_seq, info_seq);
+  }
+  return taken;
+}
+
+}  // namespace
+
+TEST(TimeBasedFilterTest, test_set_time_based_filter_qos)
+{
+  DDS::DataReaderQos datareader_qos;
+  datareader_qos.deadline.period.sec = DDS::DURATION_INFINITE_SEC;
+  datareader_qos.deadline.period.nanosec = DDS::DURATION_INFINITE_NSEC;
+
+  ASSERT_TRUE(set_time_based_filter_qos(milliseconds(100), datareader_qos));
+  EXPECT_EQ(0, datareader_qos.time_based_filter.minimum_separation.sec);
+  EXPECT_EQ(100000000u, datareader_qos.time_based_filter.minimum_separation.nanosec);
+
+  ASSERT_TRUE(set_time_based_filter_qos(milliseconds(0), datareader_qos));
+  EXPECT_EQ(0, datareader_qos.time_based_filter.minimum_separation.sec);
+  EXPECT_EQ(0u, datareader_qos.time_based_filter.minimum_separation.nanosec);
+
+  // samples can't be expected every 50 ms while at most one every 100 ms is let through
+  datareader_qos.deadline.period.sec = 0;
+  datareader_qos.deadline.period.nanosec = 50000000;
+  EXPECT_FALSE(set_time_based_filter_qos(milliseconds(100), datareader_qos));
+  rmw_reset_error();
+  EXPECT_EQ(0u, datareader_qos.time_based_filter.minimum_separation.nanosec);
+}
+
+// A 200 Hz writer and two readers of the same topic, one of them downsampled to 10 Hz.
+TEST(TimeBasedFilterTest, test_downsampled_reader_receives_fewer_samples)
+{
+  NodePair nodes(test_identifier, 42);
+  ASSERT_TRUE(nodes.is_valid()) << rmw_get_error_string().str;
+  DDS::DomainParticipant * sender_participant = nodes.sender();
+  DDS::DomainParticipant * receiver_participant = nodes.receiver();
+
+  DDS::Topic * sender_topic = create_octets_topic(sender_participant, "test_time_based_filter");
+  DDS::Topic * receiver_topic = create_octets_topic(
+    receiver_participant, "test_time_based_filter");
+  ASSERT_NE(nullptr, sender_topic);
+  ASSERT_NE(nullptr, receiver_topic);
+
+  DDS::DataWriter * writer = sender_participant->create_datawriter(
+    sender_topic, DDS_DATAWRITER_QOS_DEFAULT, nullptr, DDS_STATUS_MASK_NONE);
+  // the qos rmw_create_subscription() gives a subscription with and without a minimum
+  // separation in its subscription options
+  DDS::DataReaderQos reader_qos;
+  ASSERT_TRUE(
+    get_datareader_qos(
+      receiver_participant, rmw_qos_profile_default, "test_time_based_filter",
+      get_pool_buffer_max_size(0, 8), 0, reader_qos)) << rmw_get_error_string().str;
+  ASSERT_TRUE(set_time_based_filter_qos(milliseconds(0), reader_qos));
+  DDS::DataReader * reader = receiver_participant->create_datareader(
+    receiver_topic, reader_qos, nullptr, DDS_STATUS_MASK_NONE);
+  ASSERT_TRUE(set_time_based_filter_qos(milliseconds(100), reader_qos));
+  DDS::DataReader * filtered_reader = receiver_participant->create_datareader(
+    receiver_topic, reader_qos, nullptr, DDS_STATUS_MASK_NONE);
+  DDSOctetsDataWriter * octets_writer = DDSOctetsDataWriter::narrow(writer);
+  DDSOctetsDataReader * octets_reader = DDSOctetsDataReader::narrow(reader);
+  DDSOctetsDataReader * filtered_octets_reader = DDSOctetsDataReader::narrow(filtered_reader);
+  ASSERT_NE(nullptr, octets_writer);
+  ASSERT_NE(nullptr, octets_reader);
+  ASSERT_NE(nullptr, filtered_octets_reader);
+
+  // Connext accepted the policy as set
+  DDS::DataReaderQos actual_qos;
+  ASSERT_EQ(DDS::RETCODE_OK, reader->get_qos(actual_qos));
+  EXPECT_EQ(0, actual_qos.time_based_filter.minimum_separation.sec);
+  EXPECT_EQ(0u, actual_qos.time_based_filter.minimum_separation.nanosec);
+  ASSERT_EQ(DDS::RETCODE_OK, filtered_reader->get_qos(actual_qos));
+  EXPECT_EQ(0, actual_qos.time_based_filter.minimum_separation.sec);
+  EXPECT_EQ(100000000u, actual_qos.time_based_filter.minimum_separation.nanosec);
+
+  ASSERT_TRUE(wait_for_matched_readers(writer, 2));
+
+  // publish for 2 seconds at 200 Hz
+  const size_t published = 400;
+  unsigned char payload[8] = {};
+  size_t received = 0;
+  size_t filtered_received = 0;
+  auto next = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < published; ++i) {
+    ASSERT_EQ(
+      DDS_RETCODE_OK, octets_writer->write(payload, sizeof(payload), DDS_HANDLE_NIL));
+    next += std::chrono::milliseconds(5);
+    std::this_thread::sleep_until(next);
+    received += take_all(octets_reader);
+    filtered_received += take_all(filtered_octets_reader);
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  received += take_all(octets_reader);
+  filtered_received += take_all(filtered_octets_reader);
+
+  // about 20 samples pass the filter, leave room for scheduling jitter of the writer
+  EXPECT_GT(received, published / 2);
+  EXPECT_GT(filtered_received, 0u);
+  EXPECT_LE(filtered_received, 40u);
+  EXPECT_LT(filtered_received * 5, received);
+
+  EXPECT_EQ(RMW_RET_OK, nodes.destroy());
+}
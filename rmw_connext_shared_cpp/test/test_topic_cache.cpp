@@ -214,7 +214,7 @@ TEST_F(TopicCacheTestFixture, test_topic_cache_get_topic_name_topic_data_map)
   expected_results["topic2"].push_back(
     {"topic2", "type2", participant_guid[1], guid[3], rmw_qos[1]});
 
-  std::vector<const DDSTopicEndpointInfo *> topic_data;
+  std::vector<DDSTopicEndpointInfo> topic_data;
   for (const auto & result_it : expected_results) {
     topic_data.clear();
     const auto & topic_name = result_it.first;
@@ -225,8 +225,8 @@ TEST_F(TopicCacheTestFixture, test_topic_cache_get_topic_name_topic_data_map)
     // Verify that the topic has all the associated data
     for (const auto & expected : expected_topic_data) {
       bool found_match = false;
-      for (const auto actual : topic_data) {
-        if (*actual == expected) {
+      for (const auto & actual : topic_data) {
+        if (actual == expected) {
           found_match = true;
           break;
         }
@@ -267,7 +267,7 @@ TEST_F(TopicCacheTestFixture, test_topic_cache_remove_topic_element_exists)
   EXPECT_EQ(0u, participant_topic_map.count("topic1"));
   EXPECT_EQ(1u, participant_topic_map.count("topic2"));
   // Verify TopicNameToTopicTypeMap
-  std::vector<const DDSTopicEndpointInfo *> topic_data;
+  std::vector<DDSTopicEndpointInfo> topic_data;
   topic_cache.fill_topic_endpoint_infos("topic1", true, topic_data);
   EXPECT_EQ(1u, topic_data.size());
 
@@ -285,7 +285,7 @@ TEST_F(TopicCacheTestFixture, test_topic_cache_remove_topic_element_exists)
   EXPECT_EQ(0u, participant_topic_map2.count("topic1"));
   EXPECT_EQ(1u, participant_topic_map2.count("topic2"));
   // Verify TopicNameToTopicTypeMap
-  std::vector<const DDSTopicEndpointInfo *> topic_data2;
+  std::vector<DDSTopicEndpointInfo> topic_data2;
   topic_cache.fill_topic_endpoint_infos("topic1", true, topic_data2);
   EXPECT_EQ(0u, topic_data2.size());
 }
@@ -304,3 +304,150 @@ TEST_F(TopicCacheTestFixture, test_topic_cache_remove_policy_element_does_not_ex
   bool did_remove = topic_cache.remove_information(test_guid, Subscriber);
   ASSERT_FALSE(did_remove);
 }
+
+TEST_F(TopicCacheTestFixture, test_topic_cache_participant_topic_types_shared_type)
+{
+  DDS::GUID_t test_guid;
+  memset(&test_guid, 100, sizeof(DDS::GUID_t));
+  // A second endpoint of the same participant on topic1/type1
+  topic_cache.add_information(
+    participant_guid[0], test_guid, "topic1", "type1", rmw_qos[0], Subscriber);
+
+  ASSERT_TRUE(topic_cache.remove_information(guid[0], Publisher));
+  std::map<std::string, std::set<std::string>> participant_topic_map;
+  topic_cache.fill_topic_names_and_types_by_guid(true, participant_topic_map, participant_guid[0]);
+  ASSERT_EQ(1u, participant_topic_map.count("topic1"));
+  EXPECT_EQ(1u, participant_topic_map["topic1"].count("type1"));
+
+  ASSERT_TRUE(topic_cache.remove_information(test_guid, Subscriber));
+  participant_topic_map.clear();
+  topic_cache.fill_topic_names_and_types_by_guid(true, participant_topic_map, participant_guid[0]);
+  EXPECT_EQ(0u, participant_topic_map.count("topic1"));
+  EXPECT_EQ(1u, participant_topic_map.count("topic2"));
+}
+
+TEST_F(TopicCacheTestFixture, test_topic_cache_changes_since)
+{
+  std::vector<DDSTopicChange> changes;
+  uint64_t latest_sequence = 0;
+  // all four additions of the fixture are recorded
+  EXPECT_TRUE(topic_cache.fill_topic_changes_since(0u, changes, latest_sequence));
+  ASSERT_EQ(4u, changes.size());
+  EXPECT_EQ(4u, latest_sequence);
+  for (size_t i = 0; i < changes.size(); ++i) {
+    EXPECT_EQ(i + 1, changes[i].sequence);
+    EXPECT_EQ(DDSTopicChangeKind::EndpointAdded, changes[i].kind);
+  }
+  EXPECT_TRUE(changes[2].info == DDSTopicEndpointInfo(
+      {"topic1", "type1", participant_guid[1], guid[2], rmw_qos[1]}));
+
+  // nothing new since the last sequence
+  changes.clear();
+  EXPECT_TRUE(topic_cache.fill_topic_changes_since(latest_sequence, changes, latest_sequence));
+  EXPECT_TRUE(changes.empty());
+  EXPECT_EQ(4u, latest_sequence);
+
+  // a removal is recorded with the information of the removed endpoint
+  ASSERT_TRUE(topic_cache.remove_information(guid[1], Subscriber));
+  EXPECT_TRUE(topic_cache.fill_topic_changes_since(latest_sequence, changes, latest_sequence));
+  ASSERT_EQ(1u, changes.size());
+  EXPECT_EQ(5u, changes[0].sequence);
+  EXPECT_EQ(5u, latest_sequence);
+  EXPECT_EQ(DDSTopicChangeKind::EndpointRemoved, changes[0].kind);
+  EXPECT_EQ("topic2", changes[0].info.topic_name);
+  EXPECT_EQ(participant_guid[0], changes[0].info.participant_guid);
+
+  // failed additions and removals are not recorded
+  changes.clear();
+  topic_cache.remove_information(guid[1], Subscriber);
+  topic_cache.add_information(
+    participant_guid[0], guid[0], "topic1", "type1", rmw_qos[0], Publisher);
+  EXPECT_TRUE(topic_cache.fill_topic_changes_since(latest_sequence, changes, latest_sequence));
+  EXPECT_TRUE(changes.empty());
+  EXPECT_EQ(5u, latest_sequence);
+}
+
+TEST(TopicCacheTest, test_topic_cache_changes_since_dropped)
+{
+  TopicCache<DDS::GUID_t> topic_cache;
+  topic_cache.set_max_recorded_changes(2u);
+  DDS::GUID_t participant_guid;
+  memset(&participant_guid, 1, sizeof(DDS::GUID_t));
+  rmw_qos_profile_t rmw_qos{};
+  for (int i = 0; i < 5; ++i) {
+    DDS::GUID_t guid;
+    memset(&guid, 10 + i, sizeof(DDS::GUID_t));
+    ASSERT_TRUE(topic_cache.add_topic(participant_guid, guid, "topic", "type", rmw_qos));
+  }
+  EXPECT_EQ(5u, topic_cache.get_sequence());
+
+  // the last two changes are retained
+  std::vector<DDSTopicChange> changes;
+  EXPECT_TRUE(topic_cache.get_changes_since(3u, changes));
+  ASSERT_EQ(2u, changes.size());
+  EXPECT_EQ(4u, changes[0].sequence);
+  EXPECT_EQ(5u, changes[1].sequence);
+
+  // older changes were dropped, the retained ones are still returned
+  changes.clear();
+  EXPECT_FALSE(topic_cache.get_changes_since(1u, changes));
+  ASSERT_EQ(2u, changes.size());
+  EXPECT_EQ(4u, changes[0].sequence);
+}
+
+TEST_F(TopicCacheTestFixture, test_topic_cache_service_names_and_types)
+{
+  DDS::GUID_t request_guid, reply_guid;
+  memset(&request_guid, 100, sizeof(DDS::GUID_t));
+  memset(&reply_guid, 101, sizeof(DDS::GUID_t));
+  topic_cache.add_information(
+    participant_guid[0], request_guid, "rq/add_two_intsRequest",
+    "example_interfaces::srv::dds_::AddTwoInts_Request_", rmw_qos[0], Publisher);
+  topic_cache.add_information(
+    participant_guid[0], reply_guid, "rr/add_two_intsReply",
+    "example_interfaces::srv::dds_::AddTwoInts_Response_", rmw_qos[0], Subscriber);
+
+  std::map<std::string, std::set<std::string>> services;
+  topic_cache.fill_service_names_and_types(services);
+  ASSERT_EQ(1u, services.size());
+  ASSERT_EQ(1u, services.count("/add_two_ints"));
+  EXPECT_EQ(1u, services["/add_two_ints"].count("example_interfaces/srv/AddTwoInts"));
+
+  // the service remains while one of its endpoints does
+  ASSERT_TRUE(topic_cache.remove_information(request_guid, Publisher));
+  services.clear();
+  topic_cache.fill_service_names_and_types(services);
+  EXPECT_EQ(1u, services.count("/add_two_ints"));
+
+  ASSERT_TRUE(topic_cache.remove_information(reply_guid, Subscriber));
+  services.clear();
+  topic_cache.fill_service_names_and_types(services);
+  EXPECT_TRUE(services.empty());
+}
+
+TEST_F(TopicCacheTestFixture, test_topic_cache_demangled_topic_endpoints)
+{
+  DDS::GUID_t ros_guid[2];
+  memset(&ros_guid[0], 100, sizeof(DDS::GUID_t));
+  memset(&ros_guid[1], 101, sizeof(DDS::GUID_t));
+  topic_cache.add_information(
+    participant_guid[0], ros_guid[0], "rt/chatter", "std_msgs::msg::dds_::String_", rmw_qos[0],
+    Publisher);
+  topic_cache.add_information(
+    participant_guid[1], ros_guid[1], "/chatter", "String", rmw_qos[1], Publisher);
+
+  // the demangled name matches both the ROS topic and the unmangled one
+  EXPECT_EQ(2u, topic_cache.count_topic("/chatter"));
+  std::vector<DDSTopicEndpointInfo> topic_data;
+  topic_cache.fill_topic_endpoint_infos("/chatter", false, topic_data);
+  EXPECT_EQ(2u, topic_data.size());
+
+  // without demangling only the exact name matches
+  topic_data.clear();
+  topic_cache.fill_topic_endpoint_infos("rt/chatter", true, topic_data);
+  ASSERT_EQ(1u, topic_data.size());
+  EXPECT_EQ("rt/chatter", topic_data[0].topic_name);
+
+  // a mangled name never matches after demangling
+  EXPECT_EQ(0u, topic_cache.count_topic("rt/chatter"));
+}
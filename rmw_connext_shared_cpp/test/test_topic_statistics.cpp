@@ -0,0 +1,79 @@
+// Copyright 2020 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+
+#include "gtest/gtest.h"
+
+#include "rmw_connext_shared_cpp/topic_statistics.hpp"
+
+using std::chrono::milliseconds;
+
+TEST(TopicStatisticsTest, test_rate_bandwidth_and_jitter)
+{
+  TopicStatistics statistics(milliseconds(1000));
+  auto start = TopicStatistics::Clock::now();
+  EXPECT_EQ(0u, statistics.get_snapshot(start).messages);
+
+  // 100 Hz with alternating 8 ms and 12 ms intervals
+  auto now = start;
+  for (int i = 0; i < 100; ++i) {
+    statistics.record(now, 100, -1);
+    now += milliseconds(i % 2 ? 12 : 8);
+  }
+  // the window isn't over yet, nothing is reported
+  EXPECT_EQ(0.0, statistics.get_snapshot(start + milliseconds(999)).window);
+
+  TopicStatisticsSnapshot snapshot = statistics.get_snapshot(start + milliseconds(1000));
+  EXPECT_DOUBLE_EQ(1.0, snapshot.window);
+  EXPECT_EQ(100u, snapshot.messages);
+  EXPECT_DOUBLE_EQ(100.0, snapshot.rate);
+  EXPECT_DOUBLE_EQ(10000.0, snapshot.bytes_per_second);
+  EXPECT_NEAR(0.010, snapshot.mean_period, 1e-4);
+  EXPECT_NEAR(0.002, snapshot.jitter, 1e-4);
+  EXPECT_EQ(0u, snapshot.aged_messages);
+
+  // the snapshot stays until the next window is over
+  snapshot = statistics.get_snapshot(start + milliseconds(1500));
+  EXPECT_EQ(100u, snapshot.messages);
+  snapshot = statistics.get_snapshot(start + milliseconds(2000));
+  EXPECT_EQ(0u, snapshot.messages);
+  EXPECT_DOUBLE_EQ(0.0, snapshot.rate);
+}
+
+TEST(TopicStatisticsTest, test_message_age)
+{
+  TopicStatistics statistics(milliseconds(100));
+  auto start = TopicStatistics::Clock::now();
+  // the first window starts with the first call
+  statistics.get_snapshot(start);
+  statistics.record(start + milliseconds(10), 10, 1000000);
+  statistics.record(start + milliseconds(20), 10, 3000000);
+  statistics.record(start + milliseconds(30), 10, -1);
+
+  TopicStatisticsSnapshot snapshot = statistics.get_snapshot(start + milliseconds(100));
+  EXPECT_EQ(3u, snapshot.messages);
+  EXPECT_EQ(2u, snapshot.aged_messages);
+  EXPECT_NEAR(0.002, snapshot.mean_age, 1e-9);
+  EXPECT_NEAR(0.003, snapshot.max_age, 1e-9);
+}
+
+TEST(TopicStatisticsTest, test_topic_selection)
+{
+  EXPECT_FALSE(is_topic_statistics_enabled("", "/chatter"));
+  EXPECT_TRUE(is_topic_statistics_enabled("*", "/chatter"));
+  EXPECT_TRUE(is_topic_statistics_enabled("/scan;/chatter", "/chatter"));
+  EXPECT_FALSE(is_topic_statistics_enabled("/scan;/chatter", "/chat"));
+  EXPECT_FALSE(is_topic_statistics_enabled(";/scan;", "/chatter"));
+}